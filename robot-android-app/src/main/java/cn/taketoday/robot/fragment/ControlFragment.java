@@ -123,6 +123,14 @@ public class ControlFragment extends ViewBindingFragment<FragmentControlBinding>
       }
     });
 
+    robotModel.connected.observe(getViewLifecycleOwner(), connected -> {
+      binding.suspension.setEnabled(connected);
+    });
+
+    binding.suspension.setOnCheckedChangeListener((buttonView, checked) -> {
+      robotModel.setSuspensionEnabled(checked);
+    });
+
     binding.robotHeight.setOnSeekBarChangeListener(new SeekBar.OnSeekBarChangeListener() {
 
       @Override
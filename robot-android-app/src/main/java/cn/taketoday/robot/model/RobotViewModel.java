@@ -25,8 +25,11 @@ import androidx.lifecycle.ViewModelStoreOwner;
 import java.util.Arrays;
 
 import cn.taketoday.robot.LoggingSupport;
+import cn.taketoday.robot.protocol.ControlMessage;
 import cn.taketoday.robot.protocol.RobotMessage;
+import cn.taketoday.robot.protocol.message.ActionType;
 import cn.taketoday.robot.protocol.message.BatteryStatus;
+import cn.taketoday.robot.protocol.message.OdometryStatus;
 import cn.taketoday.robot.protocol.message.PercentageValue;
 import cn.taketoday.robot.protocol.message.ReportType;
 import cn.taketoday.robot.protocol.message.StatusReport;
@@ -40,7 +43,10 @@ import static cn.taketoday.robot.util.RobotUtils.constrain;
  *   <li>Connection status monitoring</li>
  *   <li>Battery status updates</li>
  *   <li>Robot height control and reporting</li>
+ *   <li>Odometry pose reporting</li>
  *   <li>Emergency stop and recovery commands</li>
+ *   <li>Active suspension switch</li>
+ *   <li>Leg input shaper parameters</li>
  * </ul>
  *
  * <p>The class implements {@link DataHandler} to process incoming robot messages and
@@ -57,6 +63,8 @@ public class RobotViewModel extends ViewModel implements DataHandler, LoggingSup
 
   public final MutableLiveData<Integer> robotHeightPercentage = new MutableLiveData<>(50);
 
+  public final MutableLiveData<OdometryStatus> odometry = new MutableLiveData<>();
+
   @SuppressWarnings("NullAway.Init")
   private WritableChannel writableChannel;
 
@@ -117,8 +125,30 @@ public class RobotViewModel extends ViewModel implements DataHandler, LoggingSup
     sendMessage(RobotMessage.forEmergencyRecover());
   }
 
+  public void jump() {
+    debug("jump");
+    sendMessage(RobotMessage.forActionPlay(ActionType.jump));
+  }
+
+  public void setSuspensionEnabled(boolean enabled) {
+    debug("suspension: %s", enabled);
+    sendMessage(RobotMessage.forSuspension(enabled));
+  }
+
+  /**
+   * 按实测的俯仰自由振荡设置腿高输入整形参数
+   *
+   * @param frequency 固有频率，单位：Hz，不大于0时关闭整形
+   * @param damping 阻尼比
+   */
+  public void setLegShaper(float frequency, float damping) {
+    debug("leg shaper: %.2fHz, damping %.2f", frequency, damping);
+    sendMessage(RobotMessage.forShaper(frequency, damping));
+  }
+
   public void control(int leftPercentage, int rightPercentage) {
-    RobotMessage robotMessage = RobotMessage.forControl(leftPercentage, rightPercentage);
+    RobotMessage robotMessage = RobotMessage.forControl(
+            ControlMessage.speedOf(leftPercentage), ControlMessage.speedOf(rightPercentage));
     sendMessage(robotMessage);
   }
 
@@ -137,6 +167,9 @@ public class RobotViewModel extends ViewModel implements DataHandler, LoggingSup
         PercentageValue percentage = PercentageValue.parse(statusReport.createBodyReadable());
         robotHeightPercentage.postValue(percentage.value);
       }
+      case odometry -> {
+        odometry.postValue(statusReport.read(OdometryStatus.class));
+      }
     }
   }
 
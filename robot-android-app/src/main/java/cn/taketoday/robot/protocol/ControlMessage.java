@@ -21,7 +21,10 @@ package cn.taketoday.robot.protocol;
  * 控制消息类，用于封装左右轮速度控制指令。
  *
  * <p>该类实现了 {@link Message} 接口，表示一个控制命令消息，
- * 包含左轮和右轮的速度值，并支持将数据写入到可写对象中。</p>
+ * 包含左轮和右轮的线速度，并支持将数据写入到可写对象中。</p>
+ *
+ * <p>速度单位为 mm/s，正数前进。机器人换算成线速度和偏航角速度后闭环跟踪，
+ * 超过 250ms 没有收到新的指令会自行减速停下，因此运动中需要持续发送。</p>
  *
  * @author <a href="https://github.com/TAKETODAY">海子 Yang</a>
  * @since 1.0 2026/2/7 22:59
@@ -29,20 +32,30 @@ package cn.taketoday.robot.protocol;
 public class ControlMessage implements Message {
 
   /**
-   * 左轮速度，单位为短整型（short）。
+   * 前进满速，单位 mm/s。
+   */
+  public static final int MAX_FORWARD_SPEED = 600;
+
+  /**
+   * 后退满速，单位 mm/s。
+   */
+  public static final int MAX_BACKWARD_SPEED = 370;
+
+  /**
+   * 左轮线速度，单位 mm/s。
    */
   public final short leftWheelSpeed;
 
   /**
-   * 右轮速度，单位为短整型（short）。
+   * 右轮线速度，单位 mm/s。
    */
   public final short rightWheelSpeed;
 
   /**
    * 构造方法，初始化左右轮速度。
    *
-   * @param leftWheelSpeed 左轮速度（int 类型，会被转换为 short）
-   * @param rightWheelSpeed 右轮速度（int 类型，会被转换为 short）
+   * @param leftWheelSpeed 左轮线速度，单位 mm/s（int 类型，会被转换为 short）
+   * @param rightWheelSpeed 右轮线速度，单位 mm/s（int 类型，会被转换为 short）
    */
   public ControlMessage(int leftWheelSpeed, int rightWheelSpeed) {
     this.leftWheelSpeed = (short) leftWheelSpeed;
@@ -60,4 +73,14 @@ public class ControlMessage implements Message {
     writable.write(rightWheelSpeed);
   }
 
+  /**
+   * 按摇杆百分比换算左右轮线速度，前进、后退满速不同。
+   *
+   * @param percentage 摇杆百分比，-100~100
+   * @return 线速度，单位 mm/s
+   */
+  public static int speedOf(int percentage) {
+    return percentage * (percentage > 0 ? MAX_FORWARD_SPEED : MAX_BACKWARD_SPEED) / 100;
+  }
+
 }
@@ -41,7 +41,8 @@ public enum MessageType implements Message, Enumerable<Integer> {
   SENSOR_DATA(62),
 
   EMERGENCY_STOP(80),
-  EMERGENCY_RECOVER(81);
+  EMERGENCY_RECOVER(81),
+  MOTOR_CALIBRATE(82);
 
   public final int value;
 
@@ -22,6 +22,10 @@ import org.jspecify.annotations.Nullable;
 import java.util.Arrays;
 import java.util.concurrent.atomic.AtomicInteger;
 
+import cn.taketoday.robot.protocol.message.ActionType;
+import cn.taketoday.robot.protocol.message.ConfigShaper;
+import cn.taketoday.robot.protocol.message.ConfigType;
+import cn.taketoday.robot.protocol.message.ConfigValue;
 import cn.taketoday.robot.protocol.message.ControlJoy;
 import cn.taketoday.robot.protocol.message.ControlLegMessage;
 import cn.taketoday.robot.protocol.message.PercentageValue;
@@ -112,6 +116,20 @@ public class RobotMessage implements Message {
     return new RobotMessage(generateSequence(), MessageType.CONTROL_JOY, (byte) 0, controlMessage.toByteArray());
   }
 
+  public static RobotMessage forActionPlay(ActionType action) {
+    return new RobotMessage(generateSequence(), MessageType.ACTION_PLAY, (byte) 0, action.toByteArray());
+  }
+
+  public static RobotMessage forSuspension(boolean enabled) {
+    ConfigValue config = ConfigValue.of(ConfigType.suspension, enabled);
+    return new RobotMessage(generateSequence(), MessageType.CONFIG_SET, (byte) 0, config.toByteArray());
+  }
+
+  public static RobotMessage forShaper(float frequency, float damping) {
+    ConfigShaper config = new ConfigShaper(frequency, damping);
+    return new RobotMessage(generateSequence(), MessageType.CONFIG_SET, (byte) 0, config.toByteArray());
+  }
+
   public static RobotMessage forEmergencyStop() {
     return new RobotMessage(generateSequence(), MessageType.EMERGENCY_STOP, (byte) 0, null);
   }
@@ -120,6 +138,10 @@ public class RobotMessage implements Message {
     return new RobotMessage(generateSequence(), MessageType.EMERGENCY_RECOVER, (byte) 0, null);
   }
 
+  public static RobotMessage forMotorCalibrate() {
+    return new RobotMessage(generateSequence(), MessageType.MOTOR_CALIBRATE, (byte) 0, null);
+  }
+
   public static RobotMessage forControlLeg(int leftPercentage, int rightPercentage) {
     ControlLegMessage controlMessage = new ControlLegMessage(leftPercentage, rightPercentage);
     return new RobotMessage(generateSequence(), MessageType.CONTROL_LEG, (byte) 0, controlMessage.toByteArray());
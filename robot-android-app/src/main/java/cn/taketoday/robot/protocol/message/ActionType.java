@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 - 2026 the original author or authors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see [https://www.gnu.org/licenses/]
+ */
+
+package cn.taketoday.robot.protocol.message;
+
+import cn.taketoday.robot.protocol.Message;
+import cn.taketoday.robot.protocol.Writable;
+
+/**
+ * 预置动作，随 {@link cn.taketoday.robot.protocol.MessageType#ACTION_PLAY} 发送，
+ * 与固件 action_type_t 对应。
+ *
+ * @author <a href="https://github.com/TAKETODAY">海子 Yang</a>
+ * @since 1.0 2026/10/18 16:20
+ */
+public enum ActionType implements Message {
+
+  jump(1);
+
+  public final int value;
+
+  ActionType(int value) {
+    this.value = value;
+  }
+
+  @Override
+  public void writeTo(Writable writable) {
+    writable.write((byte) value);
+  }
+
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2025 - 2026 the original author or authors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see [https://www.gnu.org/licenses/]
+ */
+package cn.taketoday.robot.protocol.message;
+
+import cn.taketoday.robot.protocol.Message;
+import cn.taketoday.robot.protocol.Writable;
+
+/**
+ * 腿高输入整形参数，随 {@link cn.taketoday.robot.protocol.MessageType#CONFIG_SET} 发送，
+ * 对应固件 config_message_t 中的 shaper。参数保存在机器人上，重启后保持。
+ *
+ * @author <a href="https://github.com/TAKETODAY">海子 Yang</a>
+ * @since 1.0 2026/10/19 16:40
+ */
+public class ConfigShaper implements Message {
+
+  /**
+   * 俯仰振型的固有频率，单位：Hz，不大于0时关闭整形
+   */
+  public final float frequency;
+
+  /**
+   * 俯仰振型的阻尼比，0~1
+   */
+  public final float damping;
+
+  public ConfigShaper(float frequency, float damping) {
+    this.frequency = frequency;
+    this.damping = damping;
+  }
+
+  @Override
+  public void writeTo(Writable writable) {
+    writable.write(ConfigType.shaper);
+    writable.write(frequency);
+    writable.write(damping);
+  }
+
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2025 - 2026 the original author or authors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see [https://www.gnu.org/licenses/]
+ */
+
+package cn.taketoday.robot.protocol.message;
+
+import cn.taketoday.robot.protocol.Message;
+import cn.taketoday.robot.protocol.Writable;
+
+/**
+ * 参数类型，随 {@link cn.taketoday.robot.protocol.MessageType#CONFIG_SET} 发送，
+ * 与固件 config_type_t 对应。
+ *
+ * @author <a href="https://github.com/TAKETODAY">海子 Yang</a>
+ * @since 1.0 2026/10/19 10:30
+ */
+public enum ConfigType implements Message {
+
+  pid(1),
+  pid_pitch(2),
+  pid_speed(3),
+  suspension(4),
+  shaper(5);
+
+  public final int value;
+
+  ConfigType(int value) {
+    this.value = value;
+  }
+
+  @Override
+  public void writeTo(Writable writable) {
+    writable.write((byte) value);
+  }
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 - 2026 the original author or authors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see [https://www.gnu.org/licenses/]
+ */
+
+package cn.taketoday.robot.protocol.message;
+
+import cn.taketoday.robot.protocol.Message;
+import cn.taketoday.robot.protocol.Writable;
+
+/**
+ * 单字节参数，随 {@link cn.taketoday.robot.protocol.MessageType#CONFIG_SET} 发送，
+ * 对应固件 config_message_t 中的 i8。
+ *
+ * @author <a href="https://github.com/TAKETODAY">海子 Yang</a>
+ * @since 1.0 2026/10/19 14:20
+ */
+public class ConfigValue implements Message {
+
+  public final ConfigType type;
+
+  public final byte value;
+
+  public ConfigValue(ConfigType type, int value) {
+    this.type = type;
+    this.value = (byte) value;
+  }
+
+  public static ConfigValue of(ConfigType type, boolean enabled) {
+    return new ConfigValue(type, enabled ? 1 : 0);
+  }
+
+  @Override
+  public void writeTo(Writable writable) {
+    writable.write(type);
+    writable.write(value);
+  }
+
+}
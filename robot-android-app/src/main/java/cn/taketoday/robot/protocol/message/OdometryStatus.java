@@ -0,0 +1,96 @@
+/*
+ * Copyright 2025 - 2026 the original author or authors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see [https://www.gnu.org/licenses/]
+ */
+
+package cn.taketoday.robot.protocol.message;
+
+import java.util.Objects;
+
+import cn.taketoday.robot.protocol.Message;
+import cn.taketoday.robot.protocol.Readable;
+import cn.taketoday.robot.protocol.Writable;
+
+/**
+ * 里程计状态消息类，表示机器人相对上电（或复位）位置的位姿。
+ *
+ * <p>x、y 与行驶距离单位为米，航向单位为度。
+ *
+ * @author <a href="https://github.com/TAKETODAY">海子 Yang</a>
+ * @since 1.0 2026/10/18 10:12
+ */
+public class OdometryStatus implements Message {
+
+  private float x;
+
+  private float y;
+
+  private float heading;
+
+  private float distance;
+
+  @Override
+  public void writeTo(Writable writable) {
+    writable.write(x);
+    writable.write(y);
+    writable.write(heading);
+    writable.write(distance);
+  }
+
+  @Override
+  public void readFrom(Readable readable) {
+    x = readable.readFloat();
+    y = readable.readFloat();
+    heading = readable.readFloat();
+    distance = readable.readFloat();
+  }
+
+  public float getX() {
+    return x;
+  }
+
+  public float getY() {
+    return y;
+  }
+
+  public float getHeading() {
+    return heading;
+  }
+
+  public float getDistance() {
+    return distance;
+  }
+
+  @Override
+  public boolean equals(Object o) {
+    if (o == null || getClass() != o.getClass())
+      return false;
+    OdometryStatus that = (OdometryStatus) o;
+    return Float.compare(x, that.x) == 0
+            && Float.compare(y, that.y) == 0
+            && Float.compare(heading, that.heading) == 0
+            && Float.compare(distance, that.distance) == 0;
+  }
+
+  @Override
+  public int hashCode() {
+    return Objects.hash(x, y, heading, distance);
+  }
+
+  @Override
+  public String toString() {
+    return String.format("OdometryStatus[%s, %s, %s, %s]", x, y, heading, distance);
+  }
+}
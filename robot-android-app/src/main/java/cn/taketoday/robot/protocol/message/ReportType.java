@@ -33,7 +33,9 @@ public enum ReportType implements Message {
 
   battery(1),
 
-  robot_height(2);
+  robot_height(2),
+
+  odometry(3);
 
   private final int value;
 
@@ -60,6 +62,7 @@ public enum ReportType implements Message {
       return switch (value) {
         case 1 -> battery;
         case 2 -> robot_height;
+        case 3 -> odometry;
         default -> throw new IllegalArgumentException("unknown report type: " + value);
       };
     }
@@ -37,6 +37,8 @@ mpu6050_axis_value_t* attitude_get_gyroscope();
 mpu6050_axis_value_t* attitude_get_acceleration();
 
 float attitude_get_pitch();
+/** @brief 仅由加速度计算出的俯仰角（°），未与陀螺仪融合 */
+float attitude_get_accel_pitch();
 float attitude_get_roll();
 float attitude_get_yaw();
 
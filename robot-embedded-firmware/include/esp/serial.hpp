@@ -58,6 +58,16 @@ public:
   void begin(int baud, uart_word_length_t wordLength = UART_DATA_8_BITS,
     uart_parity_t parity = UART_PARITY_DISABLE, uart_stop_bits_t stopBits = UART_STOP_BITS_1);
 
+  /**
+   * @brief SerialPort begin function that also installs a UART event queue,
+   * for callers that want event driven reception instead of polling.
+   *
+   * @param baud uart baud rate.
+   * @param eventQueueSize depth of the UART event queue
+   * @return the event queue, nullptr if the driver is already installed
+   */
+  QueueHandle_t beginWithEvents(int baud, int eventQueueSize);
+
   /**
    * @brief Whether the RX buffer has data.
    *
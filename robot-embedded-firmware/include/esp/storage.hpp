@@ -0,0 +1,57 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+#include "defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Load a blob from NVS.
+ *
+ * @param name_space NVS namespace
+ * @param key entry key
+ * @param value destination buffer
+ * @param length in: buffer size, out: stored blob size
+ * @return true if the entry exists and fits into the buffer
+ */
+bool storage_load(const char* name_space, const char* key, void* value, size_t* length);
+
+/**
+ * @brief Save a blob to NVS and commit it.
+ *
+ * @param name_space NVS namespace
+ * @param key entry key
+ * @param value source buffer
+ * @param length blob size
+ * @return true on success
+ */
+bool storage_save(const char* name_space, const char* key, const void* value, size_t length);
+
+/**
+ * @brief Remove an entry from NVS.
+ *
+ * @param name_space NVS namespace
+ * @param key entry key
+ * @return true if the entry was removed or did not exist
+ */
+bool storage_erase(const char* name_space, const char* key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -57,13 +57,21 @@ typedef enum : uint8_t {
 
   MESSAGE_EMERGENCY_STOP = 80,
   MESSAGE_EMERGENCY_RECOVER = 81,
+  MESSAGE_MOTOR_CALIBRATE = 82, // 电机标定（齿槽补偿、KV 辨识），轮子需悬空
 
 } message_type_t;
 
+// 预置动作，由 MESSAGE_ACTION_PLAY 触发
+typedef enum : uint8_t {
+  ACTION_JUMP = 1,
+} action_type_t;
+
 typedef enum : uint8_t {
   PID = 1,
   PID_PITCH = 2,
   PID_SPEED = 3,
+  SUSPENSION = 4, // 主动悬挂开关，数据为 i8：0 关闭，非0 开启
+  SHAPER = 5,     // 腿高输入整形，数据为两个 f32：俯仰固有频率（Hz，不大于0关闭）、阻尼比
 
 } config_type_t;
 
@@ -77,9 +85,10 @@ typedef enum : uint8_t {
 } ack_status_t;
 
 
+// 速度控制：左右轮线速度，单位：mm/s，正数前进
 typedef struct {
-  uint16_t left_wheel_speed;
-  uint16_t right_wheel_speed;
+  int16_t left_wheel_speed;
+  int16_t right_wheel_speed;
 } control_message_t;
 
 typedef struct {
@@ -92,6 +101,10 @@ typedef struct {
   uint8_t right_percentage;
 } control_leg_message_t;
 
+typedef struct {
+  action_type_t action;
+} action_play_message_t;
+
 
 typedef struct {
   float P;
@@ -99,6 +112,11 @@ typedef struct {
   float D;
 } config_pid_message_t;
 
+typedef struct {
+  float frequency;
+  float damping;
+} config_shaper_message_t;
+
 typedef struct {
   config_type_t type;
 
@@ -112,6 +130,7 @@ typedef struct {
     float f;
     double d;
     config_pid_message_t pid;
+    config_shaper_message_t shaper;
   } data;
 
 } config_message_t;
@@ -162,6 +181,7 @@ typedef struct {
     control_message_t control;
     control_leg_message_t control_leg;
     control_joy_message_t control_joy;
+    action_play_message_t action_play;
 
     percentage_t height;
     config_message_t config;
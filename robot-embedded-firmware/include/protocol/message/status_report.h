@@ -26,6 +26,7 @@ extern "C" {
 typedef enum : uint8_t {
   status_battery = 1,
   status_robot_height = 2,
+  status_odometry = 3,
 
 } status_type_t;
 
@@ -34,12 +35,20 @@ typedef struct {
   uint8_t percentage;
 } status_battery_t;
 
+typedef struct {
+  float x;        // 位置，单位：米
+  float y;
+  float heading;  // 航向，单位：°
+  float distance; // 行驶里程，单位：米
+} status_odometry_t;
+
 typedef struct {
   status_type_t type;
 
   union {
     status_battery_t battery;
     percentage_t robot_height;
+    status_odometry_t odometry;
   };
 
 } status_report_t;
@@ -63,14 +63,26 @@ void robot_init();
 
 void robot_set_height(uint8_t percentage);
 
-void robot_set_speed(uint16_t left_wheel_speed, uint16_t right_wheel_speed);
+/**
+ * @brief 速度控制，平衡环跟踪换算出的线速度和偏航角速度
+ * @param left_wheel_speed 左轮线速度，单位：mm/s，正数前进
+ * @param right_wheel_speed 右轮线速度，单位：mm/s，正数前进
+ */
+void robot_set_speed(int16_t left_wheel_speed, int16_t right_wheel_speed);
 
 void robot_set_joy(int8_t x, int8_t y);
 
+/**
+ * @brief 执行预置动作（跳跃等），条件不满足时忽略
+ */
+void robot_play_action(uint8_t action);
+
 void robot_stop();
 
 void robot_recover();
 
+void robot_calibrate_motors();
+
 bool robot_controller_is_connected();
 
 #ifdef __cplusplus
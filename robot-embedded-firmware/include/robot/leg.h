@@ -23,12 +23,104 @@ extern "C" {
 #endif
 //@formatter:on
 
+/**
+ * @brief 单个腿部舵机的反馈数据
+ */
+typedef struct {
+  int16_t position;    // 位置，单位：舵机计数
+  int16_t speed;       // 速度，单位：计数/秒
+  int16_t load;        // 负载，单位：0.1%最大扭矩，符号为方向
+  uint8_t voltage;     // 电压，单位：0.1V
+  uint8_t temperature; // 温度，单位：°C
+} robot_leg_servo_telemetry_t;
+
+/**
+ * @brief 腿部遥测快照，由遥测任务周期性地通过一次 SYNC READ 采集
+ */
+typedef struct {
+  robot_leg_servo_telemetry_t left;
+  robot_leg_servo_telemetry_t right;
+  uint8_t height_percentage; // 由实测位置换算的腿高百分比
+  uint32_t timestamp;        // 采样时间，单位：毫秒
+} robot_leg_telemetry_t;
+
+/**
+ * @brief 腿高轨迹的计划状态（两腿平均）及对应的质心位置，供平衡控制做前馈
+ */
+typedef struct {
+  float height;           // 计划腿高，单位：%
+  float velocity;         // 单位：%/s
+  float acceleration;     // 单位：%/s²
+  float com_offset;       // 质心相对轮轴的水平偏移（车身坐标），单位：mm，向前为正
+  float com_height;       // 质心相对轮轴的高度（车身坐标），单位：mm
+  float pitch_offset;     // 质心位于轮轴正上方时的俯仰角，单位：°
+} robot_leg_plan_t;
+
+/**
+ * @brief 腿部连杆运动学，由 tools/leg_kinematics.py 离线生成的查找表插值得到
+ */
+typedef struct {
+  float height;       // 轮轴到髋关节的高度，单位：mm
+  float com_offset;   // 整机质心相对轮轴的水平偏移，单位：mm，向前为正
+  float com_height;   // 整机质心相对轮轴的高度，单位：mm
+  float pitch_offset; // 质心位于轮轴正上方时的俯仰角，单位：°
+} robot_leg_kinematics_t;
+
+/**
+ * @brief 腿高偏移的来源，每个来源独立设置，互不覆盖
+ */
+typedef enum {
+  leg_offset_roll = 0,   // 横滚自平衡
+  leg_offset_suspension, // 主动悬挂
+  leg_offset_turn,       // 转弯侧倾前馈
+  leg_offset_count,
+} leg_offset_source_t;
+
 void robot_leg_init();
 
 void robot_leg_set_acceleration(uint8_t acceleration);
 
 void robot_leg_set_speed(int left_speed, int right_speed);
 
+/**
+ * @brief 设置舵机总线的指令帧率上限，两帧之间的指令会被合并
+ * @param frames_per_second 每秒最多发送的 SYNC WRITE 帧数
+ */
+void robot_leg_set_frame_rate(uint16_t frames_per_second);
+
+/**
+ * @brief 设置叠加在腿高轨迹上的偏移，各来源的偏移相加后与腿高目标合并在同一帧下发
+ * @param source 偏移来源
+ * @param left_offset 左腿偏移，单位：%
+ * @param right_offset 右腿偏移，单位：%
+ */
+void robot_leg_set_height_offset(leg_offset_source_t source, float left_offset, float right_offset);
+
+/**
+ * @brief 设置腿高指令的 ZV 输入整形参数并保存到 NVS，抵消腿高变化激起的俯仰晃动，
+ *        由 MESSAGE_CONFIG_SET（SHAPER）设置，运动中修改不会使腿跳变
+ * @param frequency 俯仰振型的固有频率，单位：Hz，不大于0时关闭整形
+ * @param damping 俯仰振型的阻尼比（0~1）
+ */
+void robot_leg_set_shaper(float frequency, float damping);
+
+/**
+ * @brief 直接下发腿高，跳过轨迹规划、输入整形和各来源的偏移，用于跳跃等预先规划好的动作
+ *
+ * 不访问总线，只更新调度器的目标并唤醒调度任务，可在控制环中调用。
+ * 舵机速度和加速度与位置在同一帧 SYNC WRITE 中下发，且不受帧率限制。
+ * @param percentage 两腿的腿高，单位：%
+ * @param speed 舵机速度，单位：计数/秒
+ * @param acceleration 舵机加速度，0 表示不限
+ */
+void robot_leg_set_direct(float percentage, uint16_t speed, uint8_t acceleration);
+
+/**
+ * @brief 结束直接控制，轨迹从当前腿高出发，按默认速度、加速度规划到目标腿高
+ * @param percentage 目标腿高，单位：%
+ */
+void robot_leg_release_direct(uint8_t percentage);
+
 //
 void robot_leg_set_height_percentage(uint8_t percentage);
 
@@ -40,8 +132,39 @@ uint8_t robot_leg_get_left_height_percentage();
 
 uint8_t robot_leg_get_right_height_percentage();
 
+/**
+ * @brief 腿高百分比
+ * @return 有遥测数据时为实测值，否则为最后一次的指令值
+ */
 uint8_t robot_leg_get_height_percentage();
 
+/**
+ * @brief 读取最新的腿部遥测快照，无锁，可在控制环中调用
+ * @return false 表示还没有有效的遥测数据
+ */
+bool robot_leg_get_telemetry(robot_leg_telemetry_t* telemetry);
+
+/**
+ * @brief 读取腿高轨迹的当前计划点，无锁
+ * @return false 表示轨迹任务尚未启动
+ */
+bool robot_leg_get_plan(robot_leg_plan_t* plan);
+
+/**
+ * @brief 按腿高百分比查表，O(1) 线性插值
+ */
+void robot_leg_kinematics_lookup(float percentage, robot_leg_kinematics_t* kinematics);
+
+/**
+ * @brief 运动学查找表的几何参数是否已实测，未实测时不应据此做平衡前馈和增益调度
+ */
+bool robot_leg_kinematics_measured();
+
+/**
+ * @brief 当前腿部姿态对应的运动学：有遥测数据时按实测舵机位置，否则按计划腿高
+ */
+void robot_leg_get_kinematics(robot_leg_kinematics_t* kinematics);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,71 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+
+// @formatter:off
+#ifdef __cplusplus
+extern "C" {
+#endif
+//@formatter:on
+
+/**
+ * @brief 轮式里程计
+ *
+ * 左右轮位置以编码器原始计数（整圈数 × 每圈计数 + 当前计数）的 int64 累计，
+ * 里程直接由累计计数换算，不随运行时间积累浮点误差；
+ * 平面位姿按控制周期积分，航向取航向估计（陀螺仪 + 轮速融合）的结果。
+ */
+typedef struct {
+  int64_t left_count;  // 左轮累计计数，前进为正
+  int64_t right_count; // 右轮累计计数，前进为正
+  float distance;      // 行驶里程（左右轮平均），单位：米
+  float x;             // 位置，起点为原点、起始朝向为 x 轴，单位：米
+  float y;
+  float heading;       // 航向，单位：°，逆时针为正
+  uint32_t timestamp;  // 更新时间，单位：毫秒
+} robot_odometry_t;
+
+/**
+ * @brief 注册里程状态上报
+ */
+void robot_odometry_init();
+
+/**
+ * @brief 由平衡环每个周期调用，积分位姿并发布
+ * @param left_count 左轮累计计数，前进为正
+ * @param right_count 右轮累计计数，前进为正
+ * @param meters_per_count 每个计数对应的轮部行程，单位：米
+ * @param heading 航向，单位：°
+ */
+void robot_odometry_update(int64_t left_count, int64_t right_count, float meters_per_count, float heading);
+
+/**
+ * @brief 位姿归零，下一次 update 时生效
+ */
+void robot_odometry_reset();
+
+/**
+ * @brief 无锁读取最新的里程与位姿
+ * @return 尚未发布过时返回 false
+ */
+bool robot_odometry_get(robot_odometry_t* odometry);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,43 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+#include "defs.h"
+
+// @formatter:off
+#ifdef __cplusplus
+extern "C" {
+#endif
+//@formatter:on
+
+/**
+ * @brief 初始化主动悬挂，默认关闭，开关状态从 NVS 恢复
+ *
+ * 开启后以固定频率读取 IMU 竖直加速度和舵机负载，
+ * 通过虚拟弹簧阻尼计算两腿共同的高度偏移，吸收颠簸和落地冲击。
+ */
+void robot_suspension_init();
+
+/**
+ * @brief 开启或关闭主动悬挂并保存到 NVS，由 MESSAGE_CONFIG_SET（SUSPENSION）设置
+ */
+void robot_suspension_set_enabled(bool enabled);
+
+bool robot_suspension_is_enabled();
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,76 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief 单写多读的无锁快照（seqlock）
+ *
+ * 写者在写入前后各递增一次序号，读者在序号为偶数且前后一致时才接受拷贝。
+ * 读写双方都不会阻塞；读者若多次撞上写入则放弃，由调用方沿用上一次的值，
+ * 这样同核高优先级读者抢占写者时也不会自旋卡死。
+ */
+template<typename T>
+class Snapshot {
+  static_assert(std::is_trivially_copyable_v<T>, "Snapshot requires a trivially copyable type");
+
+public:
+  /** @brief 发布新值，只允许一个写者 */
+  void publish(const T& value) {
+    const uint32_t seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&value_, &value, sizeof(T));
+    sequence_.store(seq + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief 读取最新值
+   * @return false 表示尚未发布过，或重试后仍与写者冲突，此时 value 未被修改
+   */
+  bool load(T& value) const {
+    for (int retry = 0; retry < 4; retry++) {
+      const uint32_t before = sequence_.load(std::memory_order_acquire);
+      if (before == 0) {
+        return false;
+      }
+      if (before & 1) {
+        continue;
+      }
+      T copy;
+      memcpy(&copy, &value_, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence_.load(std::memory_order_relaxed) == before) {
+        value = copy;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** @brief 已发布的次数，可用于判断数据是否更新 */
+  uint32_t count() const {
+    return sequence_.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  std::atomic<uint32_t> sequence_{ 0 };
+  T value_{};
+};
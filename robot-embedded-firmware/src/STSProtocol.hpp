@@ -0,0 +1,177 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+// STS/SCS wire format. Kept free of any ESP-IDF dependency so the framing
+// and the status packet parser can be exercised on a host.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sts {
+
+constexpr uint8_t HEADER = 0xFF;
+constexpr uint8_t BROADCAST_ID = 0xFE;
+
+/// Maximum number of parameter bytes in an instruction packet.
+constexpr size_t MAX_PARAMS = 64;
+
+/// Maximum number of data bytes in a status packet.
+constexpr size_t MAX_STATUS_PARAMS = 32;
+
+/// Header, id, length, instruction and checksum bytes around the parameters.
+constexpr size_t PACKET_OVERHEAD = 6;
+
+namespace instruction {
+constexpr uint8_t PING_ = 0x01;
+constexpr uint8_t READ = 0x02;
+constexpr uint8_t WRITE = 0x03;
+constexpr uint8_t REGWRITE = 0x04;
+constexpr uint8_t ACTION = 0x05;
+constexpr uint8_t RESET = 0x06;
+constexpr uint8_t SYNCREAD = 0x82;
+constexpr uint8_t SYNCWRITE = 0x83;
+}
+
+/// Result codes of a bus transaction.
+enum Result : int {
+  OK = 0,
+  TIMEOUT = -1,       ///< No (complete) answer in time
+  INVALID = -2,       ///< Malformed answer, or answer from an unexpected servo
+  CHECKSUM = -3,      ///< Answer with invalid checksum
+  BUSY = -4,          ///< Request queue full or bus not started
+  TOO_LARGE = -5      ///< Request does not fit into a packet
+};
+
+/// Checksum as defined by the protocol: inverted sum of id, length, instruction/error and parameters.
+inline uint8_t checksum(const uint8_t* data, size_t length) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < length; i++)
+    sum += data[i];
+  return ~sum;
+}
+
+/// \brief Encode an instruction packet.
+/// \param[in] servoId ID of the servo, or BROADCAST_ID
+/// \param[in] instruction Instruction id
+/// \param[in] parameters Parameters
+/// \param[in] paramLength Number of parameters
+/// \param[out] output Buffer of at least paramLength + PACKET_OVERHEAD bytes
+/// \return Number of bytes written, 0 if the packet does not fit
+inline size_t encode(uint8_t servoId, uint8_t instruction, const uint8_t* parameters,
+  size_t paramLength, uint8_t* output) {
+  if (paramLength > MAX_PARAMS)
+    return 0;
+  output[0] = HEADER;
+  output[1] = HEADER;
+  output[2] = servoId;
+  output[3] = static_cast<uint8_t>(paramLength + 2);
+  output[4] = instruction;
+  for (size_t i = 0; i < paramLength; i++)
+    output[5 + i] = parameters[i];
+  output[5 + paramLength] = checksum(&output[2], paramLength + 3);
+  return paramLength + PACKET_OVERHEAD;
+}
+
+/// Status packet sent back by a servo.
+struct StatusPacket {
+  uint8_t id;
+  uint8_t error;
+  uint8_t length; ///< Number of valid bytes in params
+  uint8_t params[MAX_STATUS_PARAMS];
+};
+
+/// \brief Byte-wise status packet parser.
+///
+/// Bytes are fed as they arrive from the UART; the parser resynchronises on
+/// the 0xFF 0xFF header after any error, so it can be driven directly from
+/// the RX event stream without knowing packet boundaries in advance.
+class PacketParser {
+public:
+  enum class Status : uint8_t {
+    PENDING,  ///< More bytes needed
+    COMPLETE, ///< packet() holds a valid status packet
+    CHECKSUM, ///< A packet was received with an invalid checksum
+    INVALID   ///< Length field out of range
+  };
+
+  PacketParser() { reset(); }
+
+  void reset() {
+    state_ = State::HEADER1;
+  }
+
+  Status feed(uint8_t c) {
+    switch (state_) {
+      case State::HEADER1:
+        if (c == HEADER)
+          state_ = State::HEADER2;
+        break;
+      case State::HEADER2:
+        state_ = c == HEADER ? State::ID : State::HEADER1;
+        break;
+      case State::ID:
+        // More than two 0xFF in a row: still in the header.
+        if (c != HEADER) {
+          packet_.id = c;
+          sum_ = c;
+          state_ = State::LENGTH;
+        }
+        break;
+      case State::LENGTH:
+        if (c < 2 || c - 2 > static_cast<int>(MAX_STATUS_PARAMS)) {
+          state_ = State::HEADER1;
+          return Status::INVALID;
+        }
+        packet_.length = c - 2;
+        sum_ += c;
+        state_ = State::ERROR;
+        break;
+      case State::ERROR:
+        packet_.error = c;
+        sum_ += c;
+        index_ = 0;
+        state_ = packet_.length > 0 ? State::PARAMS : State::CHECKSUM;
+        break;
+      case State::PARAMS:
+        packet_.params[index_++] = c;
+        sum_ += c;
+        if (index_ == packet_.length)
+          state_ = State::CHECKSUM;
+        break;
+      case State::CHECKSUM:
+        state_ = State::HEADER1;
+        return static_cast<uint8_t>(~sum_) == c ? Status::COMPLETE : Status::CHECKSUM;
+    }
+    return Status::PENDING;
+  }
+
+  const StatusPacket& packet() const {
+    return packet_;
+  }
+
+private:
+  enum class State : uint8_t {
+    HEADER1, HEADER2, ID, LENGTH, ERROR, PARAMS, CHECKSUM
+  };
+
+  State state_;
+  uint8_t sum_ = 0;
+  uint8_t index_ = 0;
+  StatusPacket packet_{};
+};
+
+}
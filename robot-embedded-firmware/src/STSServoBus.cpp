@@ -0,0 +1,167 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#include "STSServoBus.hpp"
+
+#define STS_QUEUE_LENGTH 16
+#define STS_TASK_PRIORITY 9
+
+// Time allowed for each expected status packet. At 1Mbps a packet takes well
+// under 100us, the rest is the servo's own response delay. One extra tick
+// absorbs the tick granularity.
+#define STS_RESPONSE_TIMEOUT (pdMS_TO_TICKS(2) + 1)
+
+// A servo may still answer a write we did not wait for; keep the bus quiet
+// for that long before the next request. The transport sleeps it out, nobody spins.
+#define STS_TURNAROUND_US 200
+
+struct TransferCompletion {
+  TaskHandle_t task;
+  STSResponse* response;
+  int result;
+};
+
+// STSServoBus
+
+bool STSServoBus::begin(STSTransport* transport) {
+  if (queue_ != nullptr) {
+    return true;
+  }
+  transport_ = transport;
+  QueueHandle_t queue = xQueueCreate(STS_QUEUE_LENGTH, sizeof(STSRequest));
+  if (queue == nullptr) {
+    return false;
+  }
+  queue_ = queue;
+  return xTaskCreate(task, "sts", 3072, this, STS_TASK_PRIORITY, nullptr) == pdPASS;
+}
+
+bool STSServoBus::submit(const STSRequest& request, const TickType_t timeout) {
+  if (queue_ == nullptr) {
+    return false;
+  }
+  return xQueueSend(queue_, &request, timeout) == pdTRUE;
+}
+
+int STSServoBus::transfer(STSRequest& request, STSResponse* response) {
+  TransferCompletion completion = {
+    .task = xTaskGetCurrentTaskHandle(),
+    .response = response,
+    .result = sts::BUSY
+  };
+
+  request.context = &completion;
+  request.callback = [](const int result, const STSResponse* answer, void* context) {
+    auto* completion = static_cast<TransferCompletion*>(context);
+    completion->result = result;
+    if (completion->response) {
+      if (answer) {
+        *completion->response = *answer;
+      }
+      else {
+        completion->response->count = 0;
+      }
+    }
+    xTaskNotifyGive(completion->task);
+  };
+
+  if (!submit(request, portMAX_DELAY)) {
+    return sts::BUSY;
+  }
+  // Every request completes within its response timeout, so this cannot hang.
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  return completion.result;
+}
+
+void STSServoBus::task(void* arg) {
+  auto* bus = static_cast<STSServoBus*>(arg);
+  STSRequest request;
+  STSResponse response;
+
+  for (;;) {
+    if (xQueueReceive(bus->queue_, &request, portMAX_DELAY) == pdTRUE) {
+      const int result = bus->execute(request, response);
+      if (request.callback) {
+        request.callback(result, request.responses ? &response : nullptr, request.context);
+      }
+    }
+  }
+}
+
+int STSServoBus::execute(const STSRequest& request, STSResponse& response) {
+  uint8_t packet[sts::MAX_PARAMS + sts::PACKET_OVERHEAD];
+  const size_t length = sts::encode(request.servoId, request.instruction,
+    request.params, request.paramLength, packet);
+
+  response.count = 0;
+  if (length == 0 || request.responses > STS_MAX_RESPONSES) {
+    return sts::TOO_LARGE;
+  }
+
+  // Drop late answers of a previous request, and status packets we did not wait for.
+  transport_->flush(turnaround_);
+  turnaround_ = 0;
+  if (transport_->write(packet, length) != length) {
+    return sts::TIMEOUT;
+  }
+  if (request.responses == 0) {
+    if (request.servoId != sts::BROADCAST_ID) {
+      turnaround_ = STS_TURNAROUND_US;
+    }
+    return sts::OK;
+  }
+
+  parser_.reset();
+  const TickType_t start = xTaskGetTickCount();
+  const TickType_t budget = STS_RESPONSE_TIMEOUT * request.responses;
+
+  uint8_t chunk[32];
+  for (;;) {
+    const TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= budget) {
+      return sts::TIMEOUT;
+    }
+    const size_t rd = transport_->read(chunk, sizeof(chunk), budget - elapsed);
+    for (size_t i = 0; i < rd; i++) {
+      switch (parser_.feed(chunk[i])) {
+        case sts::PacketParser::Status::PENDING:
+          break;
+        case sts::PacketParser::Status::CHECKSUM:
+          return sts::CHECKSUM;
+        case sts::PacketParser::Status::INVALID:
+          return sts::INVALID;
+        case sts::PacketParser::Status::COMPLETE: {
+          const sts::StatusPacket& answer = parser_.packet();
+          if (answer.id != expectedId(request, response.count)) {
+            return sts::INVALID;
+          }
+          response.packets[response.count++] = answer;
+          if (response.count == request.responses) {
+            return sts::OK;
+          }
+          break;
+        }
+      }
+    }
+  }
+}
+
+uint8_t STSServoBus::expectedId(const STSRequest& request, const uint8_t index) {
+  // SYNC READ: <start register> <length> <id 1> ... <id n>, answers come in that order.
+  if (request.instruction == sts::instruction::SYNCREAD) {
+    return request.params[2 + index];
+  }
+  return request.servoId;
+}
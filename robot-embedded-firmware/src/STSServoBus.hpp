@@ -0,0 +1,122 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+#include "STSProtocol.hpp"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+/// Maximum number of status packets collected for one request (SYNC READ).
+#define STS_MAX_RESPONSES 4
+
+/// Answers collected for one request.
+struct STSResponse {
+  uint8_t count;
+  sts::StatusPacket packets[STS_MAX_RESPONSES];
+};
+
+/// \brief Completion callback, called from the bus task.
+/// \param result sts::Result of the transaction
+/// \param response Collected answers, nullptr if none were expected
+/// \param context User pointer given with the request
+typedef void (*STSCallback)(int result, const STSResponse* response, void* context);
+
+/// A queued bus transaction.
+struct STSRequest {
+  uint8_t servoId;
+  uint8_t instruction;
+  uint8_t paramLength;
+  uint8_t params[sts::MAX_PARAMS];
+  uint8_t responses; ///< Number of status packets to wait for, 0 for fire-and-forget
+  STSCallback callback;
+  void* context;
+};
+
+/// \brief Byte transport used by the bus engine.
+///
+/// The engine only talks to the hardware through this interface, so it can be
+/// driven by a simulated servo instead of a UART.
+class STSTransport {
+public:
+  virtual ~STSTransport() = default;
+
+  /// \brief Write a complete packet, returning once the last bit left the wire.
+  /// \return Number of bytes written
+  virtual size_t write(const uint8_t* data, size_t length) = 0;
+
+  /// \brief Wait for received bytes.
+  /// \param[out] buffer Destination
+  /// \param[in] capacity Size of buffer
+  /// \param[in] timeout Maximum time to wait for the first byte
+  /// \return Number of bytes read, 0 on timeout
+  virtual size_t read(uint8_t* buffer, size_t capacity, TickType_t timeout) = 0;
+
+  /// \brief Drop everything received so far.
+  /// \param quietUs Time the line must have stayed quiet after the last write,
+  ///        waited out first so that a late status packet is dropped as well
+  virtual void flush(uint32_t quietUs) = 0;
+};
+
+/// \brief Asynchronous STS servo bus engine.
+///
+/// Requests are queued and executed one after the other by a dedicated task:
+/// encode, transmit, then parse answers until the expected number of status
+/// packets arrived or the response timeout expired. Completion is reported
+/// through the request callback; transfer() wraps this into a blocking call.
+class STSServoBus {
+public:
+  STSServoBus() = default;
+
+  /// \brief Start the bus task.
+  /// \param transport Byte transport, must outlive the bus
+  /// \return True on success
+  bool begin(STSTransport* transport);
+
+  /// \brief Queue a request without waiting for it.
+  /// \param request Request, copied into the queue
+  /// \param timeout Time to wait for a free queue slot
+  /// \return True if the request was queued
+  bool submit(const STSRequest& request, TickType_t timeout = 0);
+
+  /// \brief Queue a request and block the calling task until it completed.
+  /// \note Must not be called from the bus task itself (i.e. from a callback).
+  /// \param request Request, callback and context are overwritten
+  /// \param response Where to copy the answers, may be nullptr
+  /// \return sts::Result of the transaction
+  int transfer(STSRequest& request, STSResponse* response);
+
+  /// \brief Whether the bus task is running.
+  bool started() const {
+    return queue_ != nullptr;
+  }
+
+private:
+  [[noreturn]]
+  static void task(void* arg);
+
+  /// \brief Execute one request on the transport.
+  int execute(const STSRequest& request, STSResponse& response);
+
+  /// \brief ID of the servo expected to send the given answer.
+  static uint8_t expectedId(const STSRequest& request, uint8_t index);
+
+  STSTransport* transport_ = nullptr;
+  QueueHandle_t queue_ = nullptr;
+  sts::PacketParser parser_;
+  uint32_t turnaround_ = 0; ///< Quiet time owed to the last write, in us
+};
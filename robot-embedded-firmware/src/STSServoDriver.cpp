@@ -15,36 +15,40 @@
 
 #include "STSServoDriver.hpp"
 
+#include <cstring>
+
+#include "esp/misc.hpp"
 #include "esp/serial.hpp"
-#include "esp/gpio.hpp"
+#include "esp/storage.hpp"
 
-namespace instruction {
-constexpr byte PING_ = 0x01;
-constexpr byte READ = 0x02;
-constexpr byte WRITE = 0x03;
-constexpr byte REGWRITE = 0x04;
-constexpr byte ACTION = 0x05;
-constexpr byte SYNCWRITE = 0x83;
-constexpr byte RESET = 0x06;
-}
+using namespace sts;
 
+// Persisted ID -> ServoType map, see STSServoDriver::loadServoTypes
+#define SERVO_CACHE_NAMESPACE "servo"
+#define SERVO_CACHE_KEY "types"
+#define SERVO_CACHE_SIZE 16
 
-STSServoDriver::STSServoDriver() : dirPin_(GPIO_NUM_NC) {
-}
+struct ServoCacheEntry {
+  byte id;
+  ServoType type;
+};
 
 
-bool STSServoDriver::init(gpio_num_t const& dirPin, SerialPort* serialPort, int const& baudRate) {
-  // Open port
-  serialPort->begin(baudRate);
-  serialPort->setTimeout(2);
-  port_ = serialPort;
-  dirPin_ = dirPin;
-  if (this->dirPin_ < gpio_num_t::GPIO_NUM_MAX) {
-    pinMode(dirPin_, OUTPUT);
+STSServoDriver::STSServoDriver() = default;
+
+
+void STSServoDriver::open(gpio_num_t const& dirPin, SerialPort* serialPort, int const& baudRate) {
+  // Open port and start the bus task
+  if (!bus_.started() && transport_.begin(serialPort, dirPin, baudRate)) {
+    bus_.begin(&transport_);
   }
 
   for (int i = 0; i < 256; i++)
     servoType_[i] = ServoType::UNKNOWN;
+}
+
+bool STSServoDriver::init(gpio_num_t const& dirPin, SerialPort* serialPort, int const& baudRate) {
+  open(dirPin, serialPort, baudRate);
 
   // Test that a servo is present.
   for (byte i = 0; i < 0xFE; i++)
@@ -57,17 +61,83 @@ bool STSServoDriver::init(SerialPort* serialPort, int const& baudRate) {
   return this->init(gpio_num_t::GPIO_NUM_MAX, serialPort, baudRate);
 }
 
+bool STSServoDriver::init(gpio_num_t const& dirPin, SerialPort* serialPort,
+  const byte servoIds[], byte const& numberOfServos, int const& baudRate) {
+  open(dirPin, serialPort, baudRate);
+
+  loadServoTypes();
+  if (verifyServos(servoIds, numberOfServos)) {
+    return true;
+  }
+
+  // Cache is missing or stale: fall back to a full scan and refresh it.
+  for (int i = 0; i < 256; i++)
+    servoType_[i] = ServoType::UNKNOWN;
+  if (scanServos() > 0) {
+    saveServoTypes();
+  }
+
+  for (byte i = 0; i < numberOfServos; i++)
+    if (servoType_[servoIds[i]] == ServoType::UNKNOWN)
+      return false;
+  return true;
+}
+
+bool STSServoDriver::init(SerialPort* serialPort, const byte servoIds[], byte const& numberOfServos, int const& baudRate) {
+  return this->init(gpio_num_t::GPIO_NUM_MAX, serialPort, servoIds, numberOfServos, baudRate);
+}
+
+ServoType STSServoDriver::getServoType(byte const& servoId) const {
+  return servoType_[servoId];
+}
+
+bool STSServoDriver::verifyServos(const byte servoIds[], byte const& numberOfServos) {
+  for (byte i = 0; i < numberOfServos; i++) {
+    if (servoType_[servoIds[i]] == ServoType::UNKNOWN || !ping(servoIds[i]))
+      return false;
+  }
+  return true;
+}
+
+int STSServoDriver::scanServos() {
+  int found = 0;
+  for (byte i = 0; i < 0xFE; i++) {
+    if (ping(i)) {
+      determineServoType(i);
+      found++;
+    }
+  }
+  return found;
+}
+
+void STSServoDriver::loadServoTypes() {
+  ServoCacheEntry entries[SERVO_CACHE_SIZE];
+  size_t length = sizeof(entries);
+  if (!storage_load(SERVO_CACHE_NAMESPACE, SERVO_CACHE_KEY, entries, &length))
+    return;
+
+  for (size_t i = 0; i < length / sizeof(ServoCacheEntry); i++)
+    servoType_[entries[i].id] = entries[i].type;
+}
+
+void STSServoDriver::saveServoTypes() {
+  ServoCacheEntry entries[SERVO_CACHE_SIZE];
+  size_t count = 0;
+  for (int i = 0; i < 0xFE && count < SERVO_CACHE_SIZE; i++) {
+    if (servoType_[i] != ServoType::UNKNOWN) {
+      entries[count].id = static_cast<byte>(i);
+      entries[count].type = servoType_[i];
+      count++;
+    }
+  }
+  storage_save(SERVO_CACHE_NAMESPACE, SERVO_CACHE_KEY, entries, count * sizeof(ServoCacheEntry));
+}
+
 bool STSServoDriver::ping(byte const& servoId) {
-  byte response[1] = { 0xFF };
-  const int send = sendMessage(servoId, instruction::PING_, 0, response);
-  // Failed to send
-  if (send != 6)
-    return false;
-  // Read response
-  int rd = receiveMessage(servoId, 1, response);
-  if (rd < 0)
+  STSResponse response;
+  if (transferMessage(servoId, instruction::PING_, 0, nullptr, &response) != OK)
     return false;
-  return response[0] == 0x00;
+  return response.packets[0].error == 0x00;
 }
 
 bool STSServoDriver::setId(byte const& oldServoId, byte const& newServoId) {
@@ -169,35 +239,42 @@ bool STSServoDriver::setMode(unsigned char const& servoId, STSMode const& mode)
 
 
 bool STSServoDriver::triggerAction() {
-  byte noParam = 0;
-  int send = sendMessage(0xFE, instruction::ACTION, 0, &noParam);
+  int send = sendMessage(BROADCAST_ID, instruction::ACTION, 0, nullptr);
   return send == 6;
 }
 
-int STSServoDriver::sendMessage(byte const& servoId, byte const& commandID, byte const& paramLength, byte* parameters) {
+static void fillRequest(STSRequest& request, byte const& servoId, byte const& commandID,
+  byte const& paramLength, const byte* parameters, byte const& responses) {
+  request.servoId = servoId;
+  request.instruction = commandID;
+  request.paramLength = paramLength;
+  if (paramLength > 0)
+    memcpy(request.params, parameters, paramLength);
+  request.responses = responses;
+  request.callback = nullptr;
+  request.context = nullptr;
+}
 
-  byte message[6 + paramLength];
-  byte checksum = servoId + paramLength + 2 + commandID;
-  message[0] = 0xFF;
-  message[1] = 0xFF;
-  message[2] = servoId;
-  message[3] = paramLength + 2;
-  message[4] = commandID;
-  for (int i = 0; i < paramLength; i++) {
-    message[5 + i] = parameters[i];
-    checksum += parameters[i];
-  }
-  message[5 + paramLength] = ~checksum;
-  if (this->dirPin_ < GPIO_NUM_MAX) {
-    digitalWrite(dirPin_, HIGH);
-  }
-  int ret = port_->write(message, 6 + paramLength);
-  if (this->dirPin_ < GPIO_NUM_MAX) {
-    digitalWrite(dirPin_, LOW);
-  }
-  // Give time for the message to be processed.
-  delay_microseconds(200);
-  return ret;
+int STSServoDriver::sendMessage(byte const& servoId, byte const& commandID, byte const& paramLength, const byte* parameters) {
+  if (paramLength > MAX_PARAMS)
+    return 0;
+  STSRequest request;
+  fillRequest(request, servoId, commandID, paramLength, parameters, 0);
+  // Queued only: the bus task transmits it, the caller never waits for the wire.
+  if (!bus_.submit(request))
+    return 0;
+  return paramLength + PACKET_OVERHEAD;
+}
+
+int STSServoDriver::transferMessage(byte const& servoId, byte const& commandID, byte const& paramLength,
+  const byte* parameters, STSResponse* response) {
+  if (paramLength > MAX_PARAMS)
+    return TOO_LARGE;
+  if (!bus_.started())
+    return BUSY;
+  STSRequest request;
+  fillRequest(request, servoId, commandID, paramLength, parameters, 1);
+  return bus_.transfer(request, response);
 }
 
 bool STSServoDriver::writeRegisters(byte const& servoId,
@@ -205,7 +282,9 @@ bool STSServoDriver::writeRegisters(byte const& servoId,
   byte const& writeLength,
   byte const* parameters,
   bool const& asynchronous) {
-  byte param[writeLength + 1];
+  if (writeLength + 1u > MAX_PARAMS)
+    return false;
+  byte param[MAX_PARAMS];
   param[0] = startRegister;
   for (int i = 0; i < writeLength; i++)
     param[i + 1] = parameters[i];
@@ -246,78 +325,78 @@ int16_t STSServoDriver::readTwoBytesRegister(byte const& servoId, byte const& re
   }
 
   unsigned char result[2] = { 0, 0 };
-  int16_t value = 0;
-  int16_t signedValue = 0;
   int rc = readRegisters(servoId, registerId, 2, result);
   if (rc < 0)
     return 0;
+  return convertBytesToInt(servoId, result);
+}
+
+int16_t STSServoDriver::convertBytesToInt(byte const& servoId, const byte value[2], uint16_t const signBit) {
+  uint16_t raw = 0;
   switch (servoType_[servoId]) {
     case ServoType::SCS:
-      value = static_cast<int16_t>(result[1] + (result[0] << 8));
-      // Bit 15 is sign
-      signedValue = value & ~0x8000;
-      if (value & 0x8000)
-        signedValue = -signedValue;
-      return signedValue;
+      raw = value[1] + (value[0] << 8);
+      break;
     case ServoType::STS:
-      value = static_cast<int16_t>(result[0] + (result[1] << 8));
-      // Bit 15 is sign
-      signedValue = value & ~0x8000;
-      if (value & 0x8000)
-        signedValue = -signedValue;
-      return signedValue;
+      raw = value[0] + (value[1] << 8);
+      break;
     default:
       return 0;
   }
+  // Sign/magnitude, not two's complement
+  const int16_t magnitude = static_cast<int16_t>(raw & (signBit - 1));
+  return (raw & signBit) ? -magnitude : magnitude;
 }
 
 int STSServoDriver::readRegisters(byte const& servoId,
   byte const& startRegister,
   byte const& readLength,
   byte* outputBuffer) {
+  if (readLength > MAX_STATUS_PARAMS)
+    return TOO_LARGE;
   byte readParam[2] = { startRegister, readLength };
-  // Flush
-  while (port_->read() != -1) {
-  }
-
-  int send = sendMessage(servoId, instruction::READ, 2, readParam);
-  // Failed to send
-  if (send != 8)
-    return -1;
-  // Read
-  byte result[readLength + 1];
-  int rd = receiveMessage(servoId, readLength + 1, result);
-  if (rd < 0)
-    return rd;
-
-  for (int i = 0; i < readLength; i++)
-    outputBuffer[i] = result[i + 1];
-  return 0;
+  STSResponse response;
+  const int rc = transferMessage(servoId, instruction::READ, 2, readParam, &response);
+  if (rc != OK)
+    return rc;
+  if (response.packets[0].length != readLength)
+    return INVALID;
+
+  memcpy(outputBuffer, response.packets[0].params, readLength);
+  return OK;
 }
 
-int STSServoDriver::receiveMessage(byte const& servoId, byte const& readLength, byte* outputBuffer) {
-  if (this->dirPin_ < GPIO_NUM_MAX) {
-    digitalWrite(dirPin_, LOW);
+int STSServoDriver::readTelemetry(byte const& numberOfServos, const byte servoIds[], STSTelemetry telemetry[]) {
+  constexpr byte length = STSRegisters::CURRENT_TEMPERATURE - STSRegisters::CURRENT_POSITION + 1;
+  if (numberOfServos == 0 || numberOfServos > STS_MAX_RESPONSES)
+    return TOO_LARGE;
+  if (!bus_.started())
+    return BUSY;
+
+  // <start register> <length> <id 1> ... <id n>, answered by each servo in turn
+  STSRequest request;
+  byte params[2 + STS_MAX_RESPONSES] = { STSRegisters::CURRENT_POSITION, length };
+  memcpy(&params[2], servoIds, numberOfServos);
+  fillRequest(request, BROADCAST_ID, instruction::SYNCREAD, 2 + numberOfServos, params, numberOfServos);
+
+  STSResponse response;
+  const int rc = bus_.transfer(request, &response);
+  if (rc != OK)
+    return rc;
+
+  for (int i = 0; i < numberOfServos; i++) {
+    const StatusPacket& packet = response.packets[i];
+    if (packet.length != length)
+      return INVALID;
+    const byte* data = packet.params;
+    telemetry[i].position = convertBytesToInt(servoIds[i], &data[0]);
+    telemetry[i].speed = convertBytesToInt(servoIds[i], &data[STSRegisters::CURRENT_SPEED - STSRegisters::CURRENT_POSITION]);
+    // Load reports its direction in bit 10
+    telemetry[i].load = convertBytesToInt(servoIds[i], &data[STSRegisters::CURRENT_DRIVE_VOLTAGE - STSRegisters::CURRENT_POSITION], 0x0400);
+    telemetry[i].voltage = data[STSRegisters::CURRENT_VOLTAGE - STSRegisters::CURRENT_POSITION];
+    telemetry[i].temperature = data[STSRegisters::CURRENT_TEMPERATURE - STSRegisters::CURRENT_POSITION];
   }
-
-  byte result[readLength + 5];
-  size_t rd = port_->readBytes(result, readLength + 5);
-  if (rd != (unsigned short) (readLength + 5))
-    return -1;
-  // Check message integrity
-  if (result[0] != 0xFF || result[1] != 0xFF || result[2] != servoId || result[3] != readLength + 1)
-    return -2;
-  byte checksum = 0;
-  for (int i = 2; i < readLength + 4; i++)
-    checksum += result[i];
-  checksum = ~checksum;
-  if (result[readLength + 4] != checksum)
-    return -3;
-
-  // Copy result to output buffer
-  for (int i = 0; i < readLength; i++)
-    outputBuffer[i] = result[i + 4];
-  return 0;
+  return OK;
 }
 
 void STSServoDriver::convertIntToBytes(byte const& servoId, int const& value, byte result[2]) {
@@ -347,34 +426,45 @@ void STSServoDriver::convertIntToBytes(byte const& servoId, int const& value, by
   result[1] = static_cast<unsigned char>((servoValue >> 8) & 0xFF);
 }
 
-void STSServoDriver::sendAndUpdateChecksum(byte convertedValue[], byte& checksum) {
-  port_->write(convertedValue, 2);
-  checksum += convertedValue[0] + convertedValue[1];
-}
-
-void STSServoDriver::setTargetPositions(byte const& numberOfServos, const byte servoIds[],
+bool STSServoDriver::setTargetPositions(byte const& numberOfServos, const byte servoIds[],
   const int positions[], const int speeds[]) {
+  // <start register> <data length> then <id> <position> <padding> <speed> per servo
+  byte params[MAX_PARAMS];
+  if (2 + numberOfServos * 7u > MAX_PARAMS)
+    return false;
+  params[0] = STSRegisters::TARGET_POSITION;
+  params[1] = 6;
+  byte* entry = &params[2];
+  for (int index = 0; index < numberOfServos; index++) {
+    entry[0] = servoIds[index];
+    convertIntToBytes(servoIds[index], positions[index], &entry[1]);
+    entry[3] = 0;
+    entry[4] = 0;
+    convertIntToBytes(servoIds[index], speeds[index], &entry[5]);
+    entry += 7;
+  }
+  return sendMessage(BROADCAST_ID, instruction::SYNCWRITE, 2 + numberOfServos * 7, params) > 0;
+}
 
-  port_->write(0xFF);
-  port_->write(0xFF);
-  port_->write(0XFE);
-  port_->write(numberOfServos * 7 + 4);
-  port_->write(instruction::SYNCWRITE);
-  port_->write(STSRegisters::TARGET_POSITION);
-  port_->write(6);
-  byte checksum = 0xFE + numberOfServos * 7 + 4 + instruction::SYNCWRITE + STSRegisters::TARGET_POSITION + 6;
+bool STSServoDriver::setTargetPositions(byte const& numberOfServos, const byte servoIds[],
+  const int positions[], const int speeds[], const byte accelerations[]) {
+  // <start register> <data length> then <id> <acceleration> <position> <padding> <speed> per servo
+  byte params[MAX_PARAMS];
+  if (2 + numberOfServos * 8u > MAX_PARAMS)
+    return false;
+  params[0] = STSRegisters::TARGET_ACCELERATION;
+  params[1] = 7;
+  byte* entry = &params[2];
   for (int index = 0; index < numberOfServos; index++) {
-    checksum += servoIds[index];
-    port_->write(servoIds[index]);
-    byte intAsByte[2];
-    convertIntToBytes(servoIds[index], positions[index], intAsByte);
-    sendAndUpdateChecksum(intAsByte, checksum);
-    port_->write(0);
-    port_->write(0);
-    convertIntToBytes(servoIds[index], speeds[index], intAsByte);
-    sendAndUpdateChecksum(intAsByte, checksum);
+    entry[0] = servoIds[index];
+    entry[1] = accelerations[index];
+    convertIntToBytes(servoIds[index], positions[index], &entry[2]);
+    entry[4] = 0;
+    entry[5] = 0;
+    convertIntToBytes(servoIds[index], speeds[index], &entry[6]);
+    entry += 8;
   }
-  port_->write(~checksum);
+  return sendMessage(BROADCAST_ID, instruction::SYNCWRITE, 2 + numberOfServos * 8, params) > 0;
 }
 
 void STSServoDriver::determineServoType(byte const& servoId) {
@@ -19,6 +19,8 @@
 #include <cstdint>
 
 #include "esp/serial.hpp"
+#include "STSServoBus.hpp"
+#include "STSUartTransport.hpp"
 
 // using byte = uint8_t;
 
@@ -86,7 +88,20 @@ enum class ServoType : byte {
   SCS = 2
 };
 
+/// Feedback registers CURRENT_POSITION to CURRENT_TEMPERATURE of one servo.
+struct STSTelemetry {
+  int16_t position;    ///< Position, in counts
+  int16_t speed;       ///< Speed, in counts/s
+  int16_t load;        ///< Load, in 0.1% of the maximum torque, signed by direction
+  uint8_t voltage;     ///< Supply voltage, in 0.1V
+  uint8_t temperature; ///< Temperature, in degC
+};
+
 /// \brief Driver for STS servos, using UART
+///
+/// All bus traffic goes through an STSServoBus: writes are queued and return
+/// immediately, reads block the calling task until the answer arrived (or
+/// timed out) without spinning on the UART.
 class STSServoDriver {
 public:
   /// \brief Constructor.
@@ -109,6 +124,33 @@ public:
   /// \returns  True on success (at least one servo responds to ping)
   bool init(SerialPort* serialPort = nullptr, int const& baudRate = 1000000);
 
+  /// \brief Initialize the servo driver for a known set of servos.
+  ///
+  /// The ID to ServoType map found by the last scan is persisted in NVS. At boot only
+  /// the expected IDs are pinged and checked against that cache; the full 0..0xFD
+  /// sweep is used only when the cache is missing or does not match the bus.
+  /// \param dirPin Pin used for setting communication direction
+  /// \param serialPort Serial port
+  /// \param servoIds IDs of the servos expected on the bus
+  /// \param numberOfServos Number of expected servos
+  /// \param baudRate Baud rate, default 1Mbps
+  /// \returns True on success (every expected servo responds to ping)
+  bool init(gpio_num_t const& dirPin, SerialPort* serialPort,
+    const byte servoIds[], byte const& numberOfServos, int const& baudRate = 1000000);
+
+  /// \brief Initialize the servo driver for a known set of servos, without direction pin.
+  /// \param serialPort Serial port
+  /// \param servoIds IDs of the servos expected on the bus
+  /// \param numberOfServos Number of expected servos
+  /// \param baudRate Baud rate, default 1Mbps
+  /// \returns True on success (every expected servo responds to ping)
+  bool init(SerialPort* serialPort, const byte servoIds[], byte const& numberOfServos, int const& baudRate = 1000000);
+
+  /// \brief Get the cached type of a servo.
+  /// \param[in] servoId ID of the servo
+  /// \return Servo type, UNKNOWN if the servo has not been discovered yet.
+  ServoType getServoType(byte const& servoId) const;
+
   /// \brief Ping servo
   /// \param[in] servoId ID of the servo
   /// \return True if servo responded to ping
@@ -215,31 +257,49 @@ public:
   /// \return Register value, 0 on failure.
   int16_t readTwoBytesRegister(byte const& servoId, byte const& registerId);
 
+  /// \brief Read the feedback registers of several servos with a single SYNC READ.
+  /// \param[in] numberOfServos Number of servos, at most STS_MAX_RESPONSES
+  /// \param[in] servoIds IDs of the servos
+  /// \param[out] telemetry One entry per servo (corresponds to servoIds)
+  /// \return 0 on success, sts::Result error code otherwise
+  int readTelemetry(byte const& numberOfServos, const byte servoIds[], STSTelemetry telemetry[]);
+
   /// @brief Sets the target positions for multiple servos simultaneously.
   /// @param[in] numberOfServos Number of servo.
   /// @param[in] servoIds Array of servo IDs to control.
   /// @param[in] positions Array of target positions (corresponds to servoIds).
   /// @param[in] speeds Array of target speeds (corresponds to servoIds).
-  void setTargetPositions(byte const& numberOfServos, const byte servoIds[], const int positions[], const int speeds[]);
+  /// @return False if the frame was not queued (bus queue full), the caller has to send it again.
+  bool setTargetPositions(byte const& numberOfServos, const byte servoIds[], const int positions[], const int speeds[]);
+
+  /// @brief Sets the target positions for multiple servos simultaneously, together with the target acceleration.
+  /// @param[in] numberOfServos Number of servo.
+  /// @param[in] servoIds Array of servo IDs to control.
+  /// @param[in] positions Array of target positions (corresponds to servoIds).
+  /// @param[in] speeds Array of target speeds (corresponds to servoIds).
+  /// @param[in] accelerations Array of target accelerations, 0 for no ramp (corresponds to servoIds).
+  /// @return False if the frame was not queued (bus queue full), the caller has to send it again.
+  bool setTargetPositions(byte const& numberOfServos, const byte servoIds[], const int positions[], const int speeds[],
+    const byte accelerations[]);
 
 private:
-  /// \brief Send a message to the servos.
+  /// \brief Queue a message to the servos, without waiting for it to be sent.
   /// \param[in] servoId ID of the servo
   /// \param[in] commandID Command id
   /// \param[in] paramLength length of the parameters
   /// \param[in] parameters parameters
-  /// \return Result of write.
-  int sendMessage(byte const& servoId, byte const& commandID, byte const& paramLength, byte* parameters);
+  /// \return Length of the queued packet, 0 if the bus queue is full.
+  int sendMessage(byte const& servoId, byte const& commandID, byte const& paramLength, const byte* parameters);
 
-  /// \brief Recieve a message from a given servo.
+  /// \brief Send a message and wait for the status packet of the servo.
   /// \param[in] servoId ID of the servo
-  /// \param[in] readLength Message length
-  /// \param[in] outputBuffer Buffer where the data is placed.
-  /// \return 0 on success
-  ///         -1 if read failed due to timeout
-  ///         -2 if invalid message (no 0XFF, wrong servo id)
-  ///         -3 if invalid checksum
-  int receiveMessage(byte const& servoId, byte const& readLength, byte* outputBuffer);
+  /// \param[in] commandID Command id
+  /// \param[in] paramLength length of the parameters
+  /// \param[in] parameters parameters
+  /// \param[out] response Received status packet
+  /// \return sts::Result of the transaction
+  int transferMessage(byte const& servoId, byte const& commandID, byte const& paramLength,
+    const byte* parameters, STSResponse* response);
 
   /// \brief Write to a sequence of consecutive registers
   /// \param[in] servoId ID of the servo
@@ -256,13 +316,15 @@ private:
   /// \param[in] startRegister First register
   /// \param[in] readLength Number of registers to write
   /// \param[out] outputBuffer Buffer where to read the data (must have been allocated by the user)
-  /// \return 0 on success, -1 if write failed, -2 if read failed, -3 if checksum verification failed
+  /// \return 0 on success, -1 on timeout, -2 if invalid answer, -3 if checksum verification failed
   int readRegisters(byte const& servoId, byte const& startRegister, byte const& readLength, byte* outputBuffer);
 
-  /// @brief Send two bytes and update checksum
-  /// @param[in] convertedValue Converted int value
-  /// @param[out] checksum Update the checksum
-  void sendAndUpdateChecksum(byte convertedValue[], byte& checksum);
+  /// \brief Convert a pair of bytes received from a servo to int.
+  /// \param servoId ID of the servo
+  /// \param[in] value Register content, in bus order
+  /// \param[in] signBit Bit holding the sign (direction)
+  /// \return Signed value
+  int16_t convertBytesToInt(byte const& servoId, const byte value[2], uint16_t signBit = 0x8000);
 
   /// @brief Convert int to pair of bytes
   /// @param servoId ID of the servo
@@ -273,9 +335,26 @@ private:
   /// \brief Determine servo type (STS or SCS, they don't use exactly the same protocol)
   void determineServoType(byte const& servoId);
 
-  SerialPort* port_;
+  /// \brief Open the port, start the bus and reset the servo type cache.
+  void open(gpio_num_t const& dirPin, SerialPort* serialPort, int const& baudRate);
+
+  /// \brief Ping the expected servos and check them against the persisted type cache.
+  /// \return True if every expected servo answers and its type is cached.
+  bool verifyServos(const byte servoIds[], byte const& numberOfServos);
+
+  /// \brief Ping every ID from 0 to 0xFD and determine the type of each responder.
+  /// \return Number of servos found.
+  int scanServos();
+
+  /// \brief Load the ID to ServoType map from NVS into servoType_.
+  void loadServoTypes();
+
+  /// \brief Persist the discovered ID to ServoType map to NVS.
+  void saveServoTypes();
+
+  UartTransport transport_; ///< UART and direction pin.
 
-  gpio_num_t dirPin_; ///< Direction pin number.
+  STSServoBus bus_;
 
   ServoType servoType_[256]; // Map of servo types - STS/SCS servos have slightly different protocol.
 };
@@ -0,0 +1,115 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#include "STSUartTransport.hpp"
+
+#include "logging.hpp"
+#include "esp/gpio.hpp"
+#include "esp/misc.hpp"
+
+static auto TAG = "sts-uart";
+
+#define STS_EVENT_QUEUE_LENGTH 16
+
+// RX idle time, in symbols, after which the UART driver posts a data event.
+#define STS_RX_TIMEOUT_SYMBOLS 3
+
+bool UartTransport::begin(SerialPort* serialPort, const gpio_num_t dirPin, const int baudRate) {
+  if (quiet_ == nullptr) {
+    quiet_ = xSemaphoreCreateBinary();
+    const esp_timer_create_args_t timer_args = {
+      .callback = [](void* arg) {
+        xSemaphoreGive(static_cast<SemaphoreHandle_t>(arg));
+      },
+      .arg = quiet_,
+      .dispatch_method = ESP_TIMER_TASK,
+      .name = "sts-quiet",
+      .skip_unhandled_events = true,
+    };
+    if (quiet_ == nullptr || esp_timer_create(&timer_args, &quietTimer_) != ESP_OK) {
+      log_error("sts quiet timer create failed");
+      return false;
+    }
+  }
+
+  events_ = serialPort->beginWithEvents(baudRate, STS_EVENT_QUEUE_LENGTH);
+  if (events_ == nullptr) {
+    log_error("uart %d already in use", serialPort->getPortNumber());
+    return false;
+  }
+  uart_ = serialPort->getPortNumber();
+  uart_set_rx_timeout(uart_, STS_RX_TIMEOUT_SYMBOLS);
+
+  dirPin_ = dirPin;
+  if (dirPin_ < GPIO_NUM_MAX) {
+    pinMode(dirPin_, OUTPUT);
+    digitalWrite(dirPin_, LOW);
+  }
+  return true;
+}
+
+size_t UartTransport::write(const uint8_t* data, const size_t length) {
+  if (dirPin_ < GPIO_NUM_MAX) {
+    digitalWrite(dirPin_, HIGH);
+  }
+  const int written = uart_write_bytes(uart_, data, length);
+  // Release the bus as soon as the last stop bit is out, the servo answers right after.
+  uart_wait_tx_done(uart_, pdMS_TO_TICKS(10));
+  if (dirPin_ < GPIO_NUM_MAX) {
+    digitalWrite(dirPin_, LOW);
+  }
+  lastWrite_ = micros();
+  return written > 0 ? written : 0;
+}
+
+size_t UartTransport::read(uint8_t* buffer, const size_t capacity, const TickType_t timeout) {
+  const TickType_t start = xTaskGetTickCount();
+  for (;;) {
+    size_t buffered = 0;
+    uart_get_buffered_data_len(uart_, &buffered);
+    if (buffered > 0) {
+      const int rd = uart_read_bytes(uart_, buffer, buffered < capacity ? buffered : capacity, 0);
+      return rd > 0 ? rd : 0;
+    }
+
+    const TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= timeout) {
+      return 0;
+    }
+
+    uart_event_t event;
+    if (xQueueReceive(events_, &event, timeout - elapsed) != pdTRUE) {
+      return 0;
+    }
+    if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL) {
+      log_warn("uart %d rx overflow", uart_);
+      flush(0);
+      return 0;
+    }
+  }
+}
+
+void UartTransport::flush(const uint32_t quietUs) {
+  // The quiet period is far below a tick: block on a one-shot timer instead of spinning.
+  const uint64_t quietUntil = lastWrite_ + quietUs;
+  if (const uint64_t now = micros(); now < quietUntil) {
+    xSemaphoreTake(quiet_, 0);
+    if (esp_timer_start_once(quietTimer_, quietUntil - now) == ESP_OK) {
+      xSemaphoreTake(quiet_, portMAX_DELAY);
+    }
+  }
+  uart_flush_input(uart_);
+  xQueueReset(events_);
+}
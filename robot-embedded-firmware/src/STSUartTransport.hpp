@@ -0,0 +1,53 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+#include "STSServoBus.hpp"
+
+#include "freertos/semphr.h"
+
+#include "esp_timer.h"
+#include "esp/serial.hpp"
+
+/// \brief UART transport with RX driven by the UART event queue.
+///
+/// The RS485 direction pin is switched back to receive as soon as the TX
+/// FIFO has drained, instead of after a fixed delay.
+class UartTransport final : public STSTransport {
+public:
+  UartTransport() = default;
+
+  /// \brief Install the UART driver with an event queue.
+  /// \param serialPort Serial port
+  /// \param dirPin Direction pin, GPIO_NUM_MAX or above when not used
+  /// \param baudRate Baud rate
+  /// \return True on success
+  bool begin(SerialPort* serialPort, gpio_num_t dirPin, int baudRate);
+
+  size_t write(const uint8_t* data, size_t length) override;
+
+  size_t read(uint8_t* buffer, size_t capacity, TickType_t timeout) override;
+
+  void flush(uint32_t quietUs) override;
+
+private:
+  uart_port_t uart_ = UART_NUM_MAX;
+  gpio_num_t dirPin_ = GPIO_NUM_NC;
+  QueueHandle_t events_ = nullptr;
+  esp_timer_handle_t quietTimer_ = nullptr; ///< One-shot timer ending a quiet period
+  SemaphoreHandle_t quiet_ = nullptr;       ///< Given by quietTimer_
+  uint64_t lastWrite_ = 0;                  ///< End of the last transmission, in us
+};
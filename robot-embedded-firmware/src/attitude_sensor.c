@@ -33,6 +33,7 @@ static struct {
 
   float roll;
   float pitch;
+  float accel_pitch;
   float yaw;
 
   mpu6050_handle_t mpu6050;
@@ -119,7 +120,8 @@ void attitude_update() {
 
   this.roll = this.gyroCoef * (this.roll + this.gyro.x * this.interval) + this.accCoef * angleAccX;
   this.pitch = this.gyroCoef * (this.pitch + this.gyro.y * this.interval) + this.accCoef * angleAccY;
-  this.yaw = this.gyro.z * this.interval;
+  this.accel_pitch = angleAccY;
+  this.yaw += this.gyro.z * this.interval;
 
   this.preInterval = millis();
 }
@@ -136,6 +138,10 @@ float attitude_get_pitch() {
   return this.pitch;
 }
 
+float attitude_get_accel_pitch() {
+  return this.accel_pitch;
+}
+
 float attitude_get_roll() {
   return this.roll;
 }
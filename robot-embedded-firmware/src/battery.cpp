@@ -17,23 +17,45 @@
 #include "logging.hpp"
 #include "esp/gpio.hpp"
 
+#include <atomic>
+
 #include "esp_log.h"
 #include "esp_adc/adc_cali.h"
-#include "esp_adc/adc_oneshot.h"
+#include "esp_adc/adc_continuous.h"
 #include "esp_adc/adc_cali_scheme.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "robot/stats.h"
 
 #define BAT_PIN gpio_num_t::GPIO_NUM_35
 
+// 连续采样（DMA）：每帧 BATTERY_FRAME_SAMPLES 个采样取平均（过采样），再做一阶 IIR 滤波
+#define BATTERY_SAMPLE_FREQ 20000 // ESP32 连续模式的最低采样率
+#define BATTERY_FRAME_SAMPLES 128
+#define BATTERY_FILTER_TAU 0.05f  // IIR 时间常数，单位：秒，滤掉 PWM 纹波同时跟得上负载下的压降
+
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#define BATTERY_ADC_OUTPUT_TYPE ADC_DIGI_OUTPUT_FORMAT_TYPE1
+#define BATTERY_ADC_GET_CHANNEL(p_data) ((p_data)->type1.channel)
+#define BATTERY_ADC_GET_DATA(p_data) ((p_data)->type1.data)
+#else
+#define BATTERY_ADC_OUTPUT_TYPE ADC_DIGI_OUTPUT_FORMAT_TYPE2
+#define BATTERY_ADC_GET_CHANNEL(p_data) ((p_data)->type2.channel)
+#define BATTERY_ADC_GET_DATA(p_data) ((p_data)->type2.data)
+#endif
+
 static auto TAG = "battery";
 static constexpr adc_channel_t channel = ADC_CHANNEL_7;
 
-adc_oneshot_unit_handle_t adc1_handle;
+adc_continuous_handle_t adc1_handle = nullptr;
 
 bool do_calibration1_chan0 = false;
 
 adc_cali_handle_t adc_cali_handle = nullptr;
 
+// 滤波后的电池电压，单位：V，电机控制环每个周期无锁读取
+static std::atomic<float> filtered_voltage{ 0.0f };
+
 static struct {
   float full;
   float empty;
@@ -134,21 +156,78 @@ float battery_calculate_percentage(const float voltage) {
 }
 
 
+static float battery_raw_to_voltage(const int adc_raw) {
+  int voltage;
+  if (do_calibration1_chan0) {
+    ESP_ERROR_CHECK(adc_cali_raw_to_voltage(adc_cali_handle, adc_raw, &voltage));
+    ESP_LOGV(TAG, "ADC%d Channel[%d] Cali Voltage: %d mV", ADC_UNIT_1 + 1, channel, voltage);
+  }
+  else {
+    voltage = adc_raw;
+  }
+  return static_cast<float>(voltage) * 3.97f / 1000.0f;
+}
+
+[[noreturn]]
+static void battery_sampling_task(void*) {
+  uint8_t frame[BATTERY_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES];
+  constexpr float frame_period = static_cast<float>(BATTERY_FRAME_SAMPLES) / BATTERY_SAMPLE_FREQ;
+  constexpr float alpha = frame_period / (BATTERY_FILTER_TAU + frame_period);
+
+  for (;;) {
+    uint32_t length = 0;
+    // DMA 填满一帧后才返回，期间任务阻塞不占 CPU
+    if (adc_continuous_read(adc1_handle, frame, sizeof(frame), &length, portMAX_DELAY) != ESP_OK) {
+      continue;
+    }
+
+    uint32_t sum = 0;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+      const auto* data = reinterpret_cast<const adc_digi_output_data_t*>(&frame[i]);
+      if (BATTERY_ADC_GET_CHANNEL(data) == channel) {
+        sum += BATTERY_ADC_GET_DATA(data);
+        count++;
+      }
+    }
+    if (count == 0) {
+      continue;
+    }
+
+    // 校准曲线是非线性的，先平均原始值再换算
+    const float voltage = battery_raw_to_voltage(static_cast<int>((sum + count / 2) / count));
+    const float previous = filtered_voltage.load(std::memory_order_relaxed);
+    filtered_voltage.store(previous == 0.0f ? voltage : previous + alpha * (voltage - previous), std::memory_order_relaxed);
+  }
+}
+
 void battery_init() {
-  adc_oneshot_unit_init_cfg_t init_config1 = {
-    .unit_id = ADC_UNIT_1,
+  adc_continuous_handle_cfg_t handle_config = {
+    .max_store_buf_size = BATTERY_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES * 4,
+    .conv_frame_size = BATTERY_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES,
   };
-  ESP_ERROR_CHECK(adc_oneshot_new_unit(&init_config1, &adc1_handle));
+  ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &adc1_handle));
 
-  adc_oneshot_chan_cfg_t config = {
+  adc_digi_pattern_config_t pattern = {
     .atten = ADC_ATTEN_DB_12,
-    .bitwidth = ADC_BITWIDTH_DEFAULT,
+    .channel = static_cast<uint8_t>(channel & 0x7),
+    .unit = ADC_UNIT_1,
+    .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
   };
-
-  ESP_ERROR_CHECK(adc_oneshot_config_channel(adc1_handle, channel, &config));
+  adc_continuous_config_t config = {
+    .pattern_num = 1,
+    .adc_pattern = &pattern,
+    .sample_freq_hz = BATTERY_SAMPLE_FREQ,
+    .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+    .format = BATTERY_ADC_OUTPUT_TYPE,
+  };
+  ESP_ERROR_CHECK(adc_continuous_config(adc1_handle, &config));
 
   do_calibration1_chan0 = adc_calibration_init(ADC_UNIT_1, channel, ADC_ATTEN_DB_12, &adc_cali_handle);
 
+  xTaskCreatePinnedToCore(battery_sampling_task, "battery", 3072, nullptr, 6, nullptr, 0);
+  ESP_ERROR_CHECK(adc_continuous_start(adc1_handle));
+
   stats_register_callback([](status_report_t* report, void*)-> bool {
     const float voltage = battery_voltage_read();
     const float percentage = battery_calculate_percentage(voltage);
@@ -166,18 +245,5 @@ float battery_capacity_read() {
 }
 
 float battery_voltage_read() {
-  int adc_raw;
-  int voltage;
-
-  ESP_ERROR_CHECK(adc_oneshot_read(adc1_handle, channel, &adc_raw));
-  ESP_LOGV(TAG, "ADC%d Channel[%d] Raw Data: %d", ADC_UNIT_1 + 1, channel, adc_raw);
-
-  if (do_calibration1_chan0) {
-    ESP_ERROR_CHECK(adc_cali_raw_to_voltage(adc_cali_handle, adc_raw, &voltage));
-    ESP_LOGV(TAG, "ADC%d Channel[%d] Cali Voltage: %d mV", ADC_UNIT_1 + 1, channel, voltage);
-  }
-  else {
-    voltage = adc_raw;
-  }
-  return static_cast<float>(voltage) * 3.97f / 1000.0f;
+  return filtered_voltage.load(std::memory_order_relaxed);
 }
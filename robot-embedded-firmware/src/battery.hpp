@@ -25,6 +25,10 @@ float battery_calculate_percentage(float voltage);
 
 void battery_init();
 
+/**
+ * @brief 滤波后的电池电压，无锁，可在控制环中每个周期调用
+ * @return 电压，单位：V；尚未采到数据时为0
+ */
 float battery_voltage_read();
 
 float battery_capacity_read();
@@ -73,6 +73,26 @@ void SerialPort::begin(const int baud, const uart_word_length_t wordLength, cons
   }
 }
 
+QueueHandle_t SerialPort::beginWithEvents(const int baud, const int eventQueueSize) {
+  if (uart_is_driver_installed(_uart_num)) {
+    return nullptr;
+  }
+
+  uart_config_t _uart_config{};
+  _uart_config.baud_rate = baud;
+  _uart_config.data_bits = UART_DATA_8_BITS;
+  _uart_config.parity = UART_PARITY_DISABLE;
+  _uart_config.stop_bits = UART_STOP_BITS_1;
+  _uart_config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+  _uart_config.source_clk = UART_SCLK_DEFAULT;
+
+  QueueHandle_t queue = nullptr;
+  uart_driver_install(_uart_num, _rxBufferSize * 2, 0, eventQueueSize, &queue, 0);
+  uart_param_config(_uart_num, &_uart_config);
+  uart_set_pin(_uart_num, _txPin, _rxPin, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+  return queue;
+}
+
 size_t SerialPort::available() {
   size_t available;
   uart_get_buffered_data_len(_uart_num, &available);
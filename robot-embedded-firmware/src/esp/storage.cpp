@@ -0,0 +1,63 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#include "esp/storage.hpp"
+
+#include "logging.hpp"
+#include "nvs.h"
+
+static auto TAG = "storage";
+
+bool storage_load(const char* name_space, const char* key, void* value, size_t* length) {
+  nvs_handle_t handle;
+  if (nvs_open(name_space, NVS_READONLY, &handle) != ESP_OK) {
+    return false;
+  }
+  const esp_err_t err = nvs_get_blob(handle, key, value, length);
+  nvs_close(handle);
+  if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+    log_warn("load %s/%s failed: %s", name_space, key, esp_err_to_name(err));
+  }
+  return err == ESP_OK;
+}
+
+bool storage_save(const char* name_space, const char* key, const void* value, size_t length) {
+  nvs_handle_t handle;
+  esp_err_t err = nvs_open(name_space, NVS_READWRITE, &handle);
+  if (err == ESP_OK) {
+    err = nvs_set_blob(handle, key, value, length);
+    if (err == ESP_OK) {
+      err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+  }
+  if (err != ESP_OK) {
+    log_error("save %s/%s failed: %s", name_space, key, esp_err_to_name(err));
+  }
+  return err == ESP_OK;
+}
+
+bool storage_erase(const char* name_space, const char* key) {
+  nvs_handle_t handle;
+  esp_err_t err = nvs_open(name_space, NVS_READWRITE, &handle);
+  if (err == ESP_OK) {
+    err = nvs_erase_key(handle, key);
+    if (err == ESP_OK) {
+      err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+  }
+  return err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND;
+}
@@ -374,6 +374,13 @@ void BLDCMotor::loopFOC() {
   // This function will not have numerical issues because it uses Sensor::getMechanicalAngle()
   // which is in range 0-2PI
   electrical_angle = electricalAngle();
+  // sensor latency compensation - the rotor keeps moving between the sensor read and the middle of the
+  // PWM application window, extrapolate the angle with the (filtered) shaft velocity
+  if (sensor && angle_advance_time > 0) {
+    const float latency = static_cast<float>(_micros() - sensor->getTimestamp()) * 1e-6f + angle_advance_time;
+    const float advance = _constrain(shaft_velocity * static_cast<float>(pole_pairs) * latency, -_PI_2, _PI_2);
+    electrical_angle = _normalizeAngle(electrical_angle + advance);
+  }
   switch (torque_controller) {
     case TorqueControlType::voltage:
       // no need to do anything really
@@ -514,6 +521,134 @@ void BLDCMotor::move(float new_target) {
       voltage.d = 0;
       break;
   }
+
+  // cogging feed forward - only when the voltage is set directly, the current loop rejects it by itself
+  if (cogging_compensation.enabled && torque_controller == TorqueControlType::voltage
+      && controller != MotionControlType::angle_openloop && controller != MotionControlType::velocity_openloop) {
+    voltage.q = _constrain(voltage.q + cogging_compensation(electrical_angle), -voltage_limit, voltage_limit);
+  }
+}
+
+// Cogging calibration
+// holds the rotor at equally spaced electrical angles and records the holding voltage
+int BLDCMotor::calibrateCogging(float holding_voltage_limit) {
+  if (!sensor || !enabled || motor_status != FOCMotorStatus::motor_ready) {
+    SIMPLEFOC_DEBUG("MOT: Cogging calib not possible, motor not ready.");
+    return 0;
+  }
+  SIMPLEFOC_DEBUG("MOT: Cogging calib.");
+
+  // position hold loop, the integral term ends up as the holding voltage
+  PIDController pid_hold{ 20.0f, 400.0f, 0.2f, 0, _constrain(holding_voltage_limit, 0.0f, voltage_limit) };
+  const bool compensation = cogging_compensation.enabled;
+  cogging_compensation.enabled = false;
+
+  // start at electrical angle 0 so table index i matches the electrical angle i/N*2PI
+  sensor->update();
+  const float step = _2PI / static_cast<float>(pole_pairs * COGGING_TABLE_SIZE);
+  const float start = shaftAngle() - electricalAngle() / static_cast<float>(pole_pairs);
+
+  float forward[COGGING_TABLE_SIZE];
+  float backward[COGGING_TABLE_SIZE];
+  int exit_flag = 1;
+
+  for (int pass = 0; pass < 2 && exit_flag; pass++) {
+    float* holding = pass == 0 ? forward : backward;
+    pid_hold.reset();
+    for (int n = 0; n < COGGING_TABLE_SIZE; n++) {
+      const int i = pass == 0 ? n : COGGING_TABLE_SIZE - 1 - n;
+      const float angle_sp = start + step * static_cast<float>(i);
+      float sum = 0.0f;
+      float error = 0.0f;
+      // 60ms to settle, then average the next 40ms
+      for (int t = 0; t < 100; t++) {
+        sensor->update();
+        error = angle_sp - shaftAngle();
+        const float uq = pid_hold(error);
+        setPhaseVoltage(uq, 0, electricalAngle());
+        if (t >= 60) sum += uq;
+        _delay(1);
+      }
+      holding[i] = sum / 40.0f;
+      // the rotor did not follow - stalled or saturated
+      if (fabsf(error) > step * 4) {
+        SIMPLEFOC_DEBUG("MOT: Cogging calib failed at ", i);
+        exit_flag = 0;
+        break;
+      }
+    }
+  }
+  setPhaseVoltage(0, 0, electricalAngle());
+
+  if (!exit_flag) {
+    cogging_compensation.enabled = compensation;
+    return 0;
+  }
+
+  for (int i = 0; i < COGGING_TABLE_SIZE; i++) {
+    forward[i] = 0.5f * (forward[i] + backward[i]);
+  }
+  cogging_compensation.set(forward);
+  cogging_compensation.enabled = true;
+  SIMPLEFOC_DEBUG("MOT: Cogging calib done.");
+  return 1;
+}
+
+// KV identification
+// free-spin ramp in voltage torque control: w = KV*sqrt(3)*RPM_TO_RADS*Uq + offset
+int BLDCMotor::identifyKV(float voltage_max) {
+  if (!sensor || !enabled || motor_status != FOCMotorStatus::motor_ready) {
+    SIMPLEFOC_DEBUG("MOT: KV ident not possible, motor not ready.");
+    return 0;
+  }
+  SIMPLEFOC_DEBUG("MOT: KV ident.");
+
+  // plain voltage control while identifying
+  const MotionControlType controller_prev = controller;
+  const float resistance_prev = phase_resistance;
+  const float kv_prev = KV_rating;
+  controller = MotionControlType::torque;
+  phase_resistance = NOT_SET;
+  KV_rating = NOT_SET;
+  voltage_max = _constrain(voltage_max, 0.0f, voltage_limit);
+
+  constexpr int steps = 6;
+  float sum_u = 0, sum_w = 0, sum_uu = 0, sum_uw = 0;
+  for (int i = 1; i <= steps; i++) {
+    const float uq = voltage_max * static_cast<float>(i) / steps;
+    float velocity = 0;
+    // 600ms to reach steady state, then average the next 200ms
+    for (int t = 0; t < 800; t++) {
+      loopFOC();
+      move(uq);
+      if (t >= 600) velocity += shaft_velocity;
+      _delay(1);
+    }
+    velocity /= 200.0f;
+    SIMPLEFOC_DEBUG("MOT: KV ident velocity: ", velocity);
+    sum_u += uq;
+    sum_w += velocity;
+    sum_uu += uq * uq;
+    sum_uw += uq * velocity;
+  }
+  move(0);
+  setPhaseVoltage(0, 0, electricalAngle());
+
+  controller = controller_prev;
+  phase_resistance = resistance_prev;
+  KV_rating = kv_prev;
+
+  // least squares slope
+  const float denominator = steps * sum_uu - sum_u * sum_u;
+  const float slope = denominator > 0 ? (steps * sum_uw - sum_u * sum_w) / denominator : 0;
+  const float kv = fabsf(slope) / (_SQRT3 * _RPM_TO_RADS);
+  if (kv < 10.0f || kv > 5000.0f) {
+    SIMPLEFOC_DEBUG("MOT: KV ident failed: ", kv);
+    return 0;
+  }
+  KV_rating = kv;
+  SIMPLEFOC_DEBUG("MOT: KV: ", KV_rating);
+  return 1;
 }
 
 
@@ -24,6 +24,7 @@
 #include "common/foc_utils.h"
 #include "common/time_utils.h"
 #include "common/defaults.h"
+#include "common/cogging_compensation.h"
 
 /**
  BLDC motor class
@@ -105,6 +106,30 @@ public:
     return FOCMotor::characteriseMotor(voltage, 1.5f);
   }
 
+  /**
+     * Measure the holding voltage versus electrical angle and store it in cogging_compensation.
+     * The rotor is held with a position loop at COGGING_TABLE_SIZE points of one electrical
+     * revolution, once forward and once backward to cancel friction.
+     * The wheel must be free to turn, the motor enabled and initFOC() done.
+     *
+     * @param voltage_limit Maximum holding voltage
+     * @returns 1 for success, 0 for failure
+     */
+  int calibrateCogging(float voltage_limit);
+
+  /**
+     * Identify the KV rating from a free-spin voltage ramp and store it in KV_rating.
+     * At steady state the applied voltage is mostly back-EMF, the slope of the
+     * velocity over the voltage gives KV, the offset (friction) is fitted away.
+     * The wheel must be free to turn, the motor enabled and initFOC() done.
+     *
+     * @param voltage_max Highest voltage of the ramp
+     * @returns 1 for success, 0 for failure
+     */
+  int identifyKV(float voltage_max);
+
+  CoggingCompensation cogging_compensation; //!< cogging feed forward added in voltage torque control
+
 private:
   // FOC methods 
 
@@ -229,6 +229,7 @@ public:
   float zero_electric_angle = NOT_SET;             //!< absolute zero electric angle - if available
   Direction sensor_direction = Direction::UNKNOWN; //!< default is CW. if sensor_direction == Direction::CCW then direction will be flipped compared to CW. Set to UNKNOWN to set by calibration
   bool pp_check_result = false;                    //!< the result of the PP check, if run during loopFOC
+  float angle_advance_time = 0.0f;                 //!< time after setting the PWM the commutation angle should target [s], e.g. half the loop period - 0 disables the sensor latency compensation
 
   /**
      * Function providing BLDCMotor class with the
@@ -82,6 +82,10 @@ int32_t Sensor::getFullRotations() {
   return full_rotations;
 }
 
+unsigned long Sensor::getTimestamp() {
+  return angle_prev_ts;
+}
+
 
 int Sensor::needsSearch() {
   return 0; // default false
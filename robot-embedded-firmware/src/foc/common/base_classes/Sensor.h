@@ -101,6 +101,12 @@ public:
    */
   virtual int32_t getFullRotations();
 
+  /**
+   * Get the timestamp (in microseconds) of the last successful update(),
+   * i.e. the time the values returned by getMechanicalAngle() were read.
+   */
+  unsigned long getTimestamp();
+
   /**
    * Updates the sensor values by reading the hardware sensor.
    * Some implementations may work with interrupts, and not need this.
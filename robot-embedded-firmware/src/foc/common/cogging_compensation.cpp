@@ -0,0 +1,66 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "cogging_compensation.h"
+#include "foc_utils.h"
+#include "esp/storage.hpp"
+
+#include <cmath>
+
+#define COGGING_NVS_NAMESPACE "foc"
+
+float CoggingCompensation::operator()(const float electrical_angle) const {
+  if (!enabled) return 0.0f;
+
+  const float position = electrical_angle * (COGGING_TABLE_SIZE / _2PI);
+  const int index = static_cast<int>(position);
+  const float fraction = position - static_cast<float>(index);
+  const int16_t a = table[index & (COGGING_TABLE_SIZE - 1)];
+  const int16_t b = table[(index + 1) & (COGGING_TABLE_SIZE - 1)];
+  return (static_cast<float>(a) + fraction * static_cast<float>(b - a)) * 1e-3f;
+}
+
+bool CoggingCompensation::load(const char* key) {
+  size_t length = sizeof(table);
+  if (!storage_load(COGGING_NVS_NAMESPACE, key, table, &length) || length != sizeof(table)) {
+    enabled = false;
+    return false;
+  }
+  enabled = true;
+  return true;
+}
+
+bool CoggingCompensation::save(const char* key) const {
+  return storage_save(COGGING_NVS_NAMESPACE, key, table, sizeof(table));
+}
+
+bool CoggingCompensation::erase(const char* key) {
+  enabled = false;
+  return storage_erase(COGGING_NVS_NAMESPACE, key);
+}
+
+void CoggingCompensation::set(const float* voltages) {
+  float mean = 0.0f;
+  for (int i = 0; i < COGGING_TABLE_SIZE; i++) {
+    mean += voltages[i];
+  }
+  mean /= COGGING_TABLE_SIZE;
+
+  for (int i = 0; i < COGGING_TABLE_SIZE; i++) {
+    const float mv = _constrain((voltages[i] - mean) * 1000.0f, -32767.0f, 32767.0f);
+    table[i] = static_cast<int16_t>(lroundf(mv));
+  }
+}
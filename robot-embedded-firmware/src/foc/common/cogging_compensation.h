@@ -0,0 +1,70 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#ifndef COGGING_COMPENSATION_H
+#define COGGING_COMPENSATION_H
+
+#include "defs.h"
+
+// number of table entries per electrical revolution, must be a power of two
+#define COGGING_TABLE_SIZE 128
+
+/**
+ *  Cogging / torque ripple compensation table
+ *
+ *  Holds the voltage needed to hold the rotor still versus electrical angle,
+ *  as measured by BLDCMotor::calibrateCogging(). A gimbal motor with 12 slots
+ *  and 14 poles cogs 12 times per electrical revolution, so one electrical
+ *  revolution is enough to describe the whole ripple.
+ */
+class CoggingCompensation {
+public:
+  CoggingCompensation() = default;
+
+  /**
+     * Feed forward voltage at the given electrical angle, linearly interpolated
+     *
+     * @param electrical_angle - electrical angle in range 0-2PI
+     * @returns q voltage to add, 0 if the table is not enabled
+     */
+  float operator()(float electrical_angle) const;
+
+  /**
+     * Load the table from NVS, enables the compensation on success
+     *
+     * @param key - NVS key, one per motor
+     */
+  bool load(const char* key);
+  /** Save the table to NVS */
+  bool save(const char* key) const;
+  /** Erase the table from NVS and disable the compensation */
+  bool erase(const char* key);
+
+  /**
+     * Replace the table with measured holding voltages
+     * The mean value (load torque, friction bias) is removed, only the ripple is kept.
+     *
+     * @param voltages - COGGING_TABLE_SIZE holding voltages, equally spaced over one electrical revolution
+     */
+  void set(const float* voltages);
+
+  bool enabled = false; //!< compensation on/off flag
+
+private:
+  int16_t table[COGGING_TABLE_SIZE] = {}; //!< holding voltage in mV
+};
+
+#endif // COGGING_COMPENSATION_H
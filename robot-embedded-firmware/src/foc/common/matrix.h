@@ -0,0 +1,270 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <cmath>
+#include <cstddef>
+
+/**
+ *  Fixed-size matrix
+ *
+ *  Dimensions are template parameters, storage is a plain row-major array on the
+ *  stack or inside the owning object - no heap. All loops have compile-time bounds
+ *  so the compiler unrolls them for the small sizes used in the control math.
+ *
+ * @tparam R - number of rows
+ * @tparam C - number of columns
+ * @tparam T - element type
+ */
+template<size_t R, size_t C, typename T = float>
+struct Matrix {
+  static_assert(R > 0 && C > 0, "Matrix dimensions must be positive");
+
+  static constexpr size_t rows = R;
+  static constexpr size_t cols = C;
+
+  T data[R][C]; //!< row-major elements
+
+  /** All elements zero */
+  static constexpr Matrix zeros() {
+    Matrix m{};
+    return m;
+  }
+
+  /** Identity matrix (square matrices only) */
+  static constexpr Matrix identity() {
+    static_assert(R == C, "identity() requires a square matrix");
+    Matrix m{};
+    for (size_t i = 0; i < R; i++) m.data[i][i] = T(1);
+    return m;
+  }
+
+  constexpr T& operator()(size_t row, size_t col) { return data[row][col]; }
+  constexpr const T& operator()(size_t row, size_t col) const { return data[row][col]; }
+
+  /** Element access for vectors (one column or one row) */
+  constexpr T& operator[](size_t i) {
+    static_assert(R == 1 || C == 1, "operator[] requires a vector");
+    return C == 1 ? data[i][0] : data[0][i];
+  }
+  constexpr const T& operator[](size_t i) const {
+    static_assert(R == 1 || C == 1, "operator[] requires a vector");
+    return C == 1 ? data[i][0] : data[0][i];
+  }
+
+  constexpr Matrix& operator+=(const Matrix& other) {
+    for (size_t i = 0; i < R; i++)
+      for (size_t j = 0; j < C; j++) data[i][j] += other.data[i][j];
+    return *this;
+  }
+
+  constexpr Matrix& operator-=(const Matrix& other) {
+    for (size_t i = 0; i < R; i++)
+      for (size_t j = 0; j < C; j++) data[i][j] -= other.data[i][j];
+    return *this;
+  }
+
+  constexpr Matrix& operator*=(T scalar) {
+    for (size_t i = 0; i < R; i++)
+      for (size_t j = 0; j < C; j++) data[i][j] *= scalar;
+    return *this;
+  }
+
+  constexpr Matrix operator+(const Matrix& other) const { Matrix m = *this; return m += other; }
+  constexpr Matrix operator-(const Matrix& other) const { Matrix m = *this; return m -= other; }
+  constexpr Matrix operator*(T scalar) const { Matrix m = *this; return m *= scalar; }
+  constexpr Matrix operator/(T scalar) const { Matrix m = *this; return m *= T(1) / scalar; }
+  constexpr Matrix operator-() const { Matrix m = *this; return m *= T(-1); }
+
+  /** Matrix product */
+  template<size_t K>
+  constexpr Matrix<R, K, T> operator*(const Matrix<C, K, T>& other) const {
+    Matrix<R, K, T> m{};
+    for (size_t i = 0; i < R; i++)
+      for (size_t k = 0; k < K; k++) {
+        T sum = T(0);
+        for (size_t j = 0; j < C; j++) sum += data[i][j] * other.data[j][k];
+        m.data[i][k] = sum;
+      }
+    return m;
+  }
+
+  constexpr Matrix<C, R, T> transpose() const {
+    Matrix<C, R, T> m{};
+    for (size_t i = 0; i < R; i++)
+      for (size_t j = 0; j < C; j++) m.data[j][i] = data[i][j];
+    return m;
+  }
+
+  /** Make a square matrix exactly symmetric, (A + Aᵀ) / 2 - keeps covariances from drifting */
+  constexpr void symmetrize() {
+    static_assert(R == C, "symmetrize() requires a square matrix");
+    for (size_t i = 0; i < R; i++)
+      for (size_t j = i + 1; j < C; j++) {
+        const T v = (data[i][j] + data[j][i]) * T(0.5);
+        data[i][j] = v;
+        data[j][i] = v;
+      }
+  }
+};
+
+template<size_t R, size_t C, typename T>
+constexpr Matrix<R, C, T> operator*(T scalar, const Matrix<R, C, T>& m) {
+  return m * scalar;
+}
+
+template<size_t N, typename T = float>
+using Vector = Matrix<N, 1, T>;
+
+/**
+ *  Cholesky decomposition A = L Lᵀ of a symmetric positive definite matrix
+ *
+ *  Intended for covariance matrices (innovation covariance, normal equations).
+ */
+template<size_t N, typename T = float>
+class Cholesky {
+public:
+  /** Decompose A, check ok() before solving */
+  explicit constexpr Cholesky(const Matrix<N, N, T>& A) {
+    for (size_t j = 0; j < N; j++) {
+      T d = A.data[j][j];
+      for (size_t k = 0; k < j; k++) d -= L.data[j][k] * L.data[j][k];
+      if (!(d > T(0))) {
+        positive_definite = false;
+        return;
+      }
+      const T ljj = std::sqrt(d);
+      L.data[j][j] = ljj;
+      for (size_t i = j + 1; i < N; i++) {
+        T s = A.data[i][j];
+        for (size_t k = 0; k < j; k++) s -= L.data[i][k] * L.data[j][k];
+        L.data[i][j] = s / ljj;
+      }
+    }
+  }
+
+  /** false if A was not positive definite */
+  constexpr bool ok() const { return positive_definite; }
+
+  /** Solve A X = B */
+  template<size_t K>
+  constexpr Matrix<N, K, T> solve(const Matrix<N, K, T>& B) const {
+    Matrix<N, K, T> X = B;
+    for (size_t k = 0; k < K; k++) {
+      // forward substitution L y = b
+      for (size_t i = 0; i < N; i++) {
+        T s = X.data[i][k];
+        for (size_t j = 0; j < i; j++) s -= L.data[i][j] * X.data[j][k];
+        X.data[i][k] = s / L.data[i][i];
+      }
+      // back substitution Lᵀ x = y
+      for (size_t ii = N; ii-- > 0;) {
+        T s = X.data[ii][k];
+        for (size_t j = ii + 1; j < N; j++) s -= L.data[j][ii] * X.data[j][k];
+        X.data[ii][k] = s / L.data[ii][ii];
+      }
+    }
+    return X;
+  }
+
+  Matrix<N, N, T> L{}; //!< lower triangular factor
+
+private:
+  bool positive_definite = true;
+};
+
+/**
+ *  LU decomposition with partial pivoting, P A = L U
+ *
+ *  For general square systems, e.g. least squares in system identification.
+ */
+template<size_t N, typename T = float>
+class LU {
+public:
+  /** Decompose A, check ok() before solving */
+  explicit constexpr LU(const Matrix<N, N, T>& A) : factors(A) {
+    for (size_t i = 0; i < N; i++) pivot[i] = i;
+    for (size_t k = 0; k < N; k++) {
+      // pick the largest pivot in column k
+      size_t p = k;
+      T max = std::fabs(factors.data[k][k]);
+      for (size_t i = k + 1; i < N; i++) {
+        const T v = std::fabs(factors.data[i][k]);
+        if (v > max) {
+          max = v;
+          p = i;
+        }
+      }
+      if (!(max > T(0))) {
+        singular = true;
+        return;
+      }
+      if (p != k) {
+        for (size_t j = 0; j < N; j++) {
+          const T t = factors.data[k][j];
+          factors.data[k][j] = factors.data[p][j];
+          factors.data[p][j] = t;
+        }
+        const size_t t = pivot[k];
+        pivot[k] = pivot[p];
+        pivot[p] = t;
+      }
+      for (size_t i = k + 1; i < N; i++) {
+        const T f = factors.data[i][k] / factors.data[k][k];
+        factors.data[i][k] = f;
+        for (size_t j = k + 1; j < N; j++) factors.data[i][j] -= f * factors.data[k][j];
+      }
+    }
+  }
+
+  /** false if A was singular */
+  constexpr bool ok() const { return !singular; }
+
+  /** Solve A X = B */
+  template<size_t K>
+  constexpr Matrix<N, K, T> solve(const Matrix<N, K, T>& B) const {
+    Matrix<N, K, T> X{};
+    for (size_t k = 0; k < K; k++) {
+      // forward substitution with unit-diagonal L on the permuted right hand side
+      for (size_t i = 0; i < N; i++) {
+        T s = B.data[pivot[i]][k];
+        for (size_t j = 0; j < i; j++) s -= factors.data[i][j] * X.data[j][k];
+        X.data[i][k] = s;
+      }
+      // back substitution U x = y
+      for (size_t ii = N; ii-- > 0;) {
+        T s = X.data[ii][k];
+        for (size_t j = ii + 1; j < N; j++) s -= factors.data[ii][j] * X.data[j][k];
+        X.data[ii][k] = s / factors.data[ii][ii];
+      }
+    }
+    return X;
+  }
+
+  /** A⁻¹ - prefer solve() where possible */
+  constexpr Matrix<N, N, T> inverse() const {
+    return solve(Matrix<N, N, T>::identity());
+  }
+
+private:
+  Matrix<N, N, T> factors;
+  size_t pivot[N]{};
+  bool singular = false;
+};
+
+#endif // MATRIX_H
@@ -90,7 +90,12 @@ void MagneticSensorI2C::init(espp::I2c* _wire) {
 //  angle is in radians [rad]
 float MagneticSensorI2C::getSensorAngle() {
   // (number of full rotations)*2PI + current sensor angle 
-  return (getRawCount() / (float) cpr) * _2PI;
+  raw_count = getRawCount();
+  return (raw_count / (float) cpr) * _2PI;
+}
+
+int64_t MagneticSensorI2C::getCount() {
+  return static_cast<int64_t>(full_rotations) * static_cast<int64_t>(cpr) + raw_count;
 }
 
 
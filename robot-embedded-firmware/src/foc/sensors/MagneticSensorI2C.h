@@ -65,6 +65,18 @@ public:
   /** get current angle (rad) */
   float getSensorAngle() override;
 
+  /**
+   * Raw position in sensor counts including full rotations, full_rotations * cpr + raw count.
+   * Exact integer, does not lose precision over many revolutions like getAngle().
+   * Uses the values read by update().
+   */
+  int64_t getCount();
+
+  /** Sensor counts per revolution */
+  int getCountsPerRevolution() const {
+    return static_cast<int>(cpr);
+  }
+
   /** experimental function to check and fix SDA locked LOW issues */
   int checkBus(byte sda_pin, byte scl_pin);
 
@@ -73,6 +85,7 @@ public:
 
 private:
   float cpr; //!< Maximum range of the magnetic sensor
+  int raw_count = 0; //!< raw count of the last getSensorAngle() call
   MagneticSensorI2CConfig_s _conf;
 
   // I2C functions
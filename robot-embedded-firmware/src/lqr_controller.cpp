@@ -16,6 +16,9 @@
 #include "lqr_controller.hpp"
 
 #include "attitude_sensor.h"
+#include "battery.hpp"
+#include "esp/misc.hpp"
+#include "esp/storage.hpp"
 #include "logging.hpp"
 #include "robot.hpp"
 
@@ -24,8 +27,33 @@
 #include "foc/drivers/BLDCDriver3PWM.h"
 #include "foc/sensors/MagneticSensorI2C.h"
 #include "robot/leg.h"
+#include "robot/balance_estimator.hpp"
+#include "robot/differential_drive.hpp"
+#include "robot/explicit_mpc.hpp"
+#include "robot/jump_mpc_table.h"
+#include "robot/jump_sequencer.hpp"
+#include "robot/odometry.h"
+#include "robot/setpoint_shaper.hpp"
+#include "robot/turn_lean.hpp"
 
 #define balance_CORE 1
+#define BALANCE_LOOP_INTERVAL 5 // 平衡环周期，单位：毫秒
+#define roll_CORE 0 // 横滚环与平衡环分核运行，不影响俯仰环的时序
+
+#define ROLL_LOOP_INTERVAL 20    // 横滚环周期，单位：毫秒
+#define ROLL_DEADBAND 1.0f       // 横滚死区，单位：°
+#define ROLL_OFFSET_LIMIT 25.0f  // 单侧腿高偏移上限，单位：%
+
+#define COGGING_KEY_L "cogging_l"     // 齿槽补偿表在 NVS 中的键
+#define COGGING_KEY_R "cogging_r"
+#define COGGING_HOLDING_VOLTAGE 3.0f  // 标定时位置保持环的电压上限，单位：V
+
+#define MOTOR_NVS_NAMESPACE "foc"
+#define KV_KEY_L "kv_l"               // 辨识出的 KV 值在 NVS 中的键
+#define KV_KEY_R "kv_r"
+#define KV_IDENT_VOLTAGE 3.0f         // KV 辨识空转斜坡的最高电压，单位：V
+// 没有电流采样，相电阻无法辨识；取 1Ω 时力矩指令即为扣除反电动势后加在绕组上的电压（V），与原先的单位一致
+#define PHASE_RESISTANCE_NORMALIZED 1.0f
 
 static auto TAG = "LQR-controller";
 
@@ -46,23 +74,136 @@ PIDController pid_distance(0.5, 0, 0, 100000, 8);
 PIDController pid_speed(0.7, 0, 0, 100000, 8);
 PIDController pid_yaw_angle(1.0, 0, 0, 100000, 8);
 PIDController pid_yaw_gyro(0.04, 0, 0, 100000, 8);
-PIDController pid_lqr_u(1, 15, 0, 100000, 8);
-PIDController pid_zeropoint(0.002, 0, 0, 100000, 4);
+PIDController pid_yaw_heading(0.3, 0, 0, 100000, 4);
 PIDController pid_roll_angle(8, 0, 0, 100000, 450);
 
 // 低通滤波器实例
-LowPassFilter lpf_joyy(0.1); // 新输入值占输出值的10%，历史值占90%
-LowPassFilter lpf_zeropoint(0.1);
 LowPassFilter lpf_roll(0.3);
 LowPassFilter lpf_height(0.1);
 
 static constexpr float K_SCALE = -0.5f;
 
+// 低于该值认为电压采样无效（尚未采样或掉线），沿用上一次的供电电压
+static constexpr float SUPPLY_VOLTAGE_MIN = 5.0f;
+
+// 还没有有效的电压采样时按该值驱动，单位：V
+static constexpr float SUPPLY_VOLTAGE_DEFAULT = 8.0f;
+
+// 正弦调制以 driver.voltage_limit / 2 为中心，相电压幅值 Uq 最多为供电电压的一半
+static constexpr float UQ_PER_SUPPLY_VOLT = 0.5f;
+
+// 轮部几何尺寸，用于左右轮差速换算转速，单位：米
+#define WHEEL_RADIUS 0.034f
+#define WHEEL_TRACK 0.150f
+// 左右电机转速差（rad/s）到车身转速（°/s）的系数
+static constexpr float K_WHEEL_YAW_RATE = WHEEL_RADIUS / WHEEL_TRACK * 57.2957795f;
+// 转速低于该值时锁定航向，单位：°/s
+static constexpr float HEADING_LOCK_RATE = 10.0f;
+
+// 摇杆满量程对应的线速度，单位：m/s；沿用原来前进、后退不同的速度系数
+static constexpr float MAX_FORWARD_SPEED = 0.6f;
+static constexpr float MAX_BACKWARD_SPEED = 0.37f;
+// 偏航角速度到转向电压的系数，与 pid_yaw_gyro 的阻尼相同，稳态下正好转出目标角速度
+static constexpr float K_YAW_RATE_VOLTAGE = 0.04f;
+// 最大偏航角速度（°/s），对应转向电压上限 12V
+static constexpr float YAW_RATE_MAX = 300.0f;
+// 原地打转时降低车身的最小转速（°/s）
+static constexpr float SPIN_YAW_RATE = 45.0f;
+// 低于该速度（m/s）不按向心加速度限制转速，原地打转不受限
+static constexpr float MIN_CORNERING_SPEED = 0.05f;
+
+// 遥控指令整形：加速度 2m/s²（车身前倾约 12°）、加加速度 10m/s³，0 到满速约 0.5 秒；
+// 转向 900°/s²、6000°/s³；丢包 250ms（约 5 个摇杆上报周期）内沿用最后一次指令
+static SetpointShaper setpoint(2.0f, 10.0f, 900.0f, 6000.0f, 250);
+
+// 转弯侧倾前馈，低通 0.1 秒；腿高差变化小于 TURN_OFFSET_STEP（%）时不重复下发
+static TurnLean turn_lean(WHEEL_TRACK, 0.1f);
+static constexpr float TURN_OFFSET_STEP = 0.1f;
+static float turn_offset = 0;
+
+// 扰动观测器：替代原先的小转矩积分和重心自适应，估计外力矩（重心偏移、负载）和轮部外力（斜坡、摩擦）
+static DisturbanceObserver disturbance(WHEEL_RADIUS);
+
+// 跳跃阶段的显式 MPC：着地（蹬地、落地缓冲）和腾空各一张表，由 tools/jump_mpc.py 生成
+static ExplicitMpc jump_stance_mpc(jump_mpc_stance);
+static ExplicitMpc jump_flight_mpc(jump_mpc_flight);
+
+// 跳跃动作：蹲下蓄力后全速蹬腿，离地后收腿，着地后沿曲线下蹲缓冲，最后交还轨迹规划回到原来的腿高。
+// 蹬腿 250ms 内未离地则跳过腾空，直接缓冲
+#define JUMP_CROUCH_HEIGHT 5.0f   // 蓄力腿高，单位：%
+#define JUMP_TUCK_HEIGHT 40.0f    // 腾空收腿腿高，单位：%
+#define JUMP_ABSORB_HEIGHT 20.0f  // 缓冲结束腿高，单位：%
+#define JUMP_SERVO_SPEED 1600     // 与腿部轨迹默认的舵机速度一致，单位：计数/秒
+#define JUMP_SERVO_SPEED_MAX 3400 // 舵机空载最高速度，单位：计数/秒
+
+static const JumpPhase JUMP_PHASES[] = {
+  // 名称, 时长(ms), 提前结束, 超时去向, 腿部动作, 腿高(%), 舵机速度, 舵机加速度, 控制方式, 转向
+  { "crouch", 400, JumpExit::TIMEOUT, -1, JumpLeg::MIN_JERK, JUMP_CROUCH_HEIGHT, JUMP_SERVO_SPEED, 100, JumpControl::BALANCE, true },
+  { "settle", 150, JumpExit::TIMEOUT, -1, JumpLeg::STEP, JUMP_CROUCH_HEIGHT, JUMP_SERVO_SPEED, 100, JumpControl::BALANCE, true },
+  { "push", 250, JumpExit::LIFT_OFF, 4, JumpLeg::STEP, 100, JUMP_SERVO_SPEED_MAX, 0, JumpControl::MPC, false },
+  { "tuck", 400, JumpExit::TOUCH_DOWN, -1, JumpLeg::STEP, JUMP_TUCK_HEIGHT, JUMP_SERVO_SPEED_MAX, 0, JumpControl::MPC, false },
+  { "absorb", 200, JumpExit::TIMEOUT, -1, JumpLeg::MIN_JERK, JUMP_ABSORB_HEIGHT, JUMP_SERVO_SPEED_MAX, 0, JumpControl::MPC, false },
+  { "recover", 300, JumpExit::TIMEOUT, -1, JumpLeg::RELEASE, 0, 0, 0, JumpControl::BALANCE, true },
+};
+
+// 打滑时 LQR_u 的最大变化率，单位：V/s
+static constexpr float SLIP_EFFORT_SLEW = 40.0f;
+
+// 离地（非跳跃）时电机输出上限，单位：V
+static constexpr float AIRBORNE_EFFORT_LIMIT = 2.0f;
+
+// 标定 pitch_zeropoint 时的腿高，以及原先分段调整速度环增益的两个腿高
+#define NOMINAL_HEIGHT_PERCENTAGE 50
+#define HIGH_HEIGHT_PERCENTAGE 64
+
+static robot_leg_kinematics_t nominal_kinematics;
+static robot_leg_kinematics_t high_kinematics;
+static bool kinematics_measured = false; // 运动学表几何参数未实测时不做平衡零点前馈和增益插值
+
 static void foc_balance_loop(void* pvParameters);
+static void roll_balance_loop(void* pvParameters);
+static void motor_calibration_task(void* pvParameters);
+static void motor_set_supply(float supply);
+
+static TaskHandle_t calibration_task_handle = nullptr;
+
+// 俯仰角、角速度、轮部位移、速度统一由卡尔曼滤波估计
+static BalanceEstimator estimator;
+
+// 轮部位移原点（左右编码器计数之和）：估计器只看相对原点的计数，换算成 float 前先相减，
+// 位移状态始终是零点附近的小数值，不随累计圈数损失精度
+static int64_t distance_count = 0;
+static int64_t distance_origin = 0;
+static bool distance_rebase = true; // 下一周期把原点移到当前计数（启动时）
+static float distance_per_count = 0; // 每个计数对应的轮部位移，单位：rad
+
+// 读取 KV 辨识结果，有则开启反电动势补偿：Uq = target * R + U_bemf
+static void motor_load_kv(BLDCMotor& motor, const char* key) {
+  float kv = 0;
+  size_t length = sizeof(kv);
+  if (storage_load(MOTOR_NVS_NAMESPACE, key, &kv, &length) && length == sizeof(kv) && kv > 0) {
+    motor.KV_rating = kv;
+    motor.phase_resistance = PHASE_RESISTANCE_NORMALIZED;
+    log_info("%s: %.1f rpm/V", key, kv);
+  }
+  else {
+    log_warn("%s not identified, back-EMF compensation disabled", key);
+  }
+}
 
 void robot_suspended_controller_init();
 
 void lqr_controller::begin() {
+  robot_leg_kinematics_lookup(NOMINAL_HEIGHT_PERCENTAGE, &nominal_kinematics);
+  robot_leg_kinematics_lookup(HIGH_HEIGHT_PERCENTAGE, &high_kinematics);
+  kinematics_measured = robot_leg_kinematics_measured();
+  if (!kinematics_measured) {
+    log_warn("leg kinematics not measured, pitch feedforward disabled");
+  }
+  if (!jump.load(JUMP_PHASES, sizeof(JUMP_PHASES) / sizeof(JUMP_PHASES[0]), BALANCE_LOOP_INTERVAL)) {
+    log_error("jump phases do not fit the sequencer");
+  }
+
   static espp::I2c i2c({
     .port = I2C_NUM_0,
     .sda_io_num = GPIO_NUM_19,
@@ -107,8 +248,11 @@ void lqr_controller::begin() {
   // 驱动器设置
   motor_L.voltage_sensor_align = 6;
   motor_R.voltage_sensor_align = 6;
-  driverL.voltage_power_supply = 8;
-  driverR.voltage_power_supply = 8;
+  // 换相角补偿传感器延迟，并对准下一个 5ms 控制周期 PWM 作用时间的中点
+  motor_L.angle_advance_time = 0.0025f;
+  motor_R.angle_advance_time = 0.0025f;
+  driverL.voltage_power_supply = SUPPLY_VOLTAGE_DEFAULT;
+  driverR.voltage_power_supply = SUPPLY_VOLTAGE_DEFAULT;
   driverL.init();
   driverR.init();
 
@@ -130,8 +274,45 @@ void lqr_controller::begin() {
   motor_L.initFOC();
   motor_R.init();
   motor_R.initFOC();
+  // 对准完成后再把 Uq 限制到供电电压实际能输出的幅值
+  motor_set_supply(SUPPLY_VOLTAGE_DEFAULT);
+
+  // 齿槽补偿表，未标定过则不补偿
+  if (!motor_L.cogging_compensation.load(COGGING_KEY_L) || !motor_R.cogging_compensation.load(COGGING_KEY_R)) {
+    motor_L.cogging_compensation.enabled = false;
+    motor_R.cogging_compensation.enabled = false;
+    log_warn("cogging compensation not calibrated");
+  }
+  motor_load_kv(motor_L, KV_KEY_L);
+  motor_load_kv(motor_R, KV_KEY_R);
 
   xTaskCreatePinnedToCore(foc_balance_loop, "balance_loop", 4096, this, 10, &task_handle, balance_CORE);
+  xTaskCreatePinnedToCore(roll_balance_loop, "roll_loop", 3072, this, 8, &roll_task_handle, roll_CORE);
+}
+
+/**
+ * @brief 按供电电压设置驱动器和电机的电压上限
+ *
+ * 调制中心（driver.voltage_limit / 2）、相电压限幅和 Uq 限幅一起跟着电压走，
+ * 电压下降时 Uq 对称地缩小，而不是波形顶部单边饱和。
+ */
+static void motor_set_supply(const float supply) {
+  driverL.voltage_power_supply = supply;
+  driverR.voltage_power_supply = supply;
+  driverL.voltage_limit = supply;
+  driverR.voltage_limit = supply;
+  motor_L.voltage_limit = UQ_PER_SUPPLY_VOLT * supply;
+  motor_R.voltage_limit = UQ_PER_SUPPLY_VOLT * supply;
+}
+
+/**
+ * @brief 电机在当前电压下实际能执行的目标
+ *
+ * move() 输出 Uq = target + U_bemf（没有 KV 时 U_bemf 为 0），再限制在 ±voltage_limit；
+ * 这里按上一周期的 U_bemf 提前做同样的限幅，得到不饱和的那一部分。
+ */
+static float motor_applicable_target(const BLDCMotor& motor, const float target) {
+  return constrain(target, -motor.voltage_limit - motor.voltage_bemf, motor.voltage_limit - motor.voltage_bemf);
 }
 
 static void stop_motors() {
@@ -145,25 +326,59 @@ static void foc_balance_loop(void* pvParameters) {
   log_info("foc balance looping");
 
   TickType_t xLastWakeTime = xTaskGetTickCount();
-  constexpr TickType_t xFrequency = pdMS_TO_TICKS(5);
+  constexpr TickType_t xFrequency = pdMS_TO_TICKS(BALANCE_LOOP_INTERVAL);
 
   for (;;) {
     vTaskDelayUntil(&xLastWakeTime, xFrequency);
 
     attitude_update();
+    // 按实测电池电压换算占空比，同样的 LQR_u 在整个放电过程中输出同样的相电压
+    if (const float supply = battery_voltage_read(); supply > SUPPLY_VOLTAGE_MIN) {
+      motor_set_supply(supply);
+    }
+
+    // 轮部位移由整数计数换算：先减去原点再转成 float，不随累计圈数损失精度
+    const int64_t left_count = motor_L.sensor_direction * sensorL.getCount();
+    const int64_t right_count = motor_R.sensor_direction * sensorR.getCount();
+    const float radians_per_count = _2PI / static_cast<float>(sensorL.getCountsPerRevolution());
+    distance_per_count = K_SCALE * radians_per_count;
+    distance_count = left_count + right_count;
+    if (distance_rebase) {
+      distance_origin = distance_count;
+      distance_rebase = false;
+    }
+    estimator.update(BALANCE_LOOP_INTERVAL / 1000.0f, attitude_get_accel_pitch(), attitude_get_gyroscope()->y,
+      distance_per_count * static_cast<float>(distance_count - distance_origin));
+
+    setpoint.update(BALANCE_LOOP_INTERVAL / 1000.0f, millis());
 
     controller->balance_loop();
     controller->yaw_loop();
 
-    controller->joyx_last = controller->joyx;
-    controller->joyy_last = controller->joyy;
+    // K_SCALE 为负：电机角度减小为前进
+    robot_odometry_update(K_SCALE < 0 ? -left_count : left_count, K_SCALE < 0 ? -right_count : right_count,
+      WHEEL_RADIUS * radians_per_count, controller->YAW_angle);
 
     if (abs(controller->LQR_angle) > 60.0f) {
       stop_motors();
     }
     else {
-      motor_L.target = K_SCALE * (controller->LQR_u + controller->YAW_output);
-      motor_R.target = K_SCALE * (controller->LQR_u - controller->YAW_output);
+      float target_L = K_SCALE * differential_drive::left(controller->LQR_u, controller->YAW_output);
+      float target_R = K_SCALE * differential_drive::right(controller->LQR_u, controller->YAW_output);
+      // 跳跃查表按带反电动势的对象求解，输出的就是相电压 Uq；有 KV 时 move() 还会叠加 U_bemf，
+      // 这里先扣掉，补偿开不开，电机上的对象都和表一致
+      if (controller->jump.mpc()) {
+        target_L -= motor_L.voltage_bemf;
+        target_R -= motor_R.voltage_bemf;
+      }
+      motor_L.target = motor_applicable_target(motor_L, target_L);
+      motor_R.target = motor_applicable_target(motor_R, target_R);
+      // 两个电机饱和后的共模部分才是实际输出，下一周期扰动观测器、着地检测用的 LQR_u 是这个值
+      float applied = motor_L.target + motor_R.target;
+      if (controller->jump.mpc()) {
+        applied += motor_L.voltage_bemf + motor_R.voltage_bemf;
+      }
+      controller->LQR_u = applied / (2 * K_SCALE);
     }
     motor_L.loopFOC();
     motor_R.loopFOC();
@@ -173,101 +388,158 @@ static void foc_balance_loop(void* pvParameters) {
   }
 }
 
+static void roll_balance_loop(void* pvParameters) {
+  auto* controller = static_cast<lqr_controller*>(pvParameters);
+
+  TickType_t xLastWakeTime = xTaskGetTickCount();
+  constexpr TickType_t xFrequency = pdMS_TO_TICKS(ROLL_LOOP_INTERVAL);
+
+  for (;;) {
+    vTaskDelayUntil(&xLastWakeTime, xFrequency);
+    controller->roll_loop(ROLL_LOOP_INTERVAL / 1000.0f);
+  }
+}
+
 // 重置距离零点
 void lqr_controller::resetZeroPoint() {
+  // 原点移到当前计数，估计器的位移状态同步平移
+  estimator.shift_distance(distance_per_count * static_cast<float>(distance_count - distance_origin));
+  distance_origin = distance_count;
+  LQR_distance = estimator.distance();
   distance_zeropoint = LQR_distance;
-  pid_lqr_u.error_prev = 0;
   pitch_adjust = 0.0f;
 }
 
 
 // lqr自平衡控制
 void lqr_controller::balance_loop() {
-  LQR_distance = K_SCALE * (motor_L.shaft_angle + motor_R.shaft_angle);    // 两个电机的旋转角度（shaft_angle）,单位：弧度（rad）实际位移量
-  LQR_speed = K_SCALE * (motor_L.shaft_velocity + motor_R.shaft_velocity); // 两个电机角速度（shaft_velocity）,单位：弧度 / 秒（rad/s）
-  LQR_angle = attitude_get_pitch();                                        // mpu6050 pitch 角度，单位：度（°）
+  const float last_u = LQR_u;
+  LQR_distance = estimator.distance(); // 两个电机的旋转角度（shaft_angle）,单位：弧度（rad）实际位移量
+  LQR_speed = estimator.speed();       // 两个电机角速度,单位：弧度 / 秒（rad/s）
+  LQR_angle = estimator.pitch();       // pitch 角度，单位：度（°）
+  LQR_gyro = estimator.pitch_rate();   // pitch Y轴角速度,单位：度 / 秒（°/s）
+
+  // 质心随腿高前后移动，平衡零点也随之变化；剩余的偏差由扰动观测器估计
+  robot_leg_kinematics_t kinematics;
+  robot_leg_get_kinematics(&kinematics);
+  // 按计划腿高（下发给舵机的指令）给前馈，领先于遥测反馈的实测腿高；跳跃时腿由跳跃表直接控制，计划点不再有效
+  float pitch_offset = kinematics.pitch_offset;
+  if (robot_leg_plan_t plan; !jump.active() && robot_leg_get_plan(&plan)) {
+    pitch_offset = plan.pitch_offset;
+  }
+  // 转弯侧倾时左右腿高不同，质心前后位置也随之变化
+  pitch_feedforward = kinematics_measured
+                        ? pitch_offset - nominal_kinematics.pitch_offset + turn_lean.pitch_bias()
+                        : 0.0f;
+
+  // 着地检测：每个周期更新，LQR_u 此时还是上一周期的输出
+  const mpu6050_axis_value_t* acceleration = attitude_get_acceleration();
+  contact.update(BALANCE_LOOP_INTERVAL / 1000.0f,
+    sqrtf(acceleration->x * acceleration->x + acceleration->y * acceleration->y + acceleration->z * acceleration->z),
+    LQR_speed, LQR_u);
+  robot_speed_diff = contact.wheel_acceleration() * 0.1f; // 折算成 100ms 内的速度变化，沿用原来的阈值
+
+  // 跳跃：按阶段表逐拍推进，阶段切换只看节拍数和着地事件；腿部指令只写入调度器，不阻塞控制环
+  if (jump_requested.exchange(false)) {
+    jump.start((robot_leg_get_left_height_percentage() + robot_leg_get_right_height_percentage()) / 2.0f);
+  }
+  else {
+    jump.update(contact.lifted_off(), contact.landed());
+  }
+  float leg_height;
+  uint16_t servo_speed;
+  uint8_t servo_acceleration;
+  if (jump.releasing()) {
+    robot_leg_release_direct(lroundf(jump.start_height()));
+  }
+  else if (jump.leg_command(&leg_height, &servo_speed, &servo_acceleration)) {
+    robot_leg_set_direct(leg_height, servo_speed, servo_acceleration);
+  }
 
-  LQR_gyro = attitude_get_gyroscope()->y; // pitch Y轴角速度,单位：度 / 秒（°/s）
+  // 打滑检测：轮速与加速度计、左右轮差速与陀螺仪对比；加速度计装在车身上，杠杆长度近似取髋关节高度
+  const mpu6050_axis_value_t* gyroscope = attitude_get_gyroscope();
+  slip.update(BALANCE_LOOP_INTERVAL / 1000.0f, LQR_speed * WHEEL_RADIUS, contact.wheel_acceleration() * WHEEL_RADIUS,
+    acceleration->x, LQR_angle, LQR_gyro, kinematics.height / 1000.0f,
+    K_WHEEL_YAW_RATE * (motor_L.shaft_velocity - motor_R.shaft_velocity), gyroscope->z - heading.gyro_bias(),
+    contact.grounded() && !jump.active());
+  // 打滑时轮速不代表车身速度，速度环改用融合估计
+  if (slip.slipping()) {
+    LQR_speed = slip.speed() / WHEEL_RADIUS;
+  }
 
-  angle_control = pid_pitch(LQR_angle - pitch_zeropoint) + pitch_adjust;
+  // 扰动观测器：LQR_u 还是上一周期的输出；离地、跳跃、打滑时模型不成立，保持原有估计。
+  // 输入相对名义平衡角度（零点 + 前馈）的俯仰角，估计出的偏移只是在此之外多出的部分，不会把零点再扣一次
+  const float pitch_error = LQR_angle - pitch_zeropoint - pitch_feedforward;
+  if (contact.grounded() && !jump.active() && !slip.slipping()) {
+    disturbance.update(BALANCE_LOOP_INTERVAL / 1000.0f, pitch_error, LQR_gyro, LQR_speed * WHEEL_RADIUS, last_u,
+      kinematics.com_height / 1000.0f);
+  }
 
-  gyro_control = pid_gyro(LQR_gyro);
+  angle_control = pid_pitch(pitch_error - disturbance.pitch_offset()) + pitch_adjust;
 
-  // 前进后退跳跃的系数都不一样
-  float speed_target_coeff = 0.1;
-  if (joyy > 0) {
-    // 前进
-    speed_target_coeff = 0.18;
-  }
-  else if (joyy < 0) {
-    // 后退
-    speed_target_coeff = 0.11;
-  }
+  gyro_control = pid_gyro(LQR_gyro);
 
-  speed_control = pid_speed(LQR_speed - speed_target_coeff * lpf_joyy(joyy)); // 最大8v
+  // 速度参考值经过加速度、加加速度限制，换算成轮子角速度（rad/s）
+  speed_control = pid_speed(LQR_speed - setpoint.speed() / WHEEL_RADIUS); // 最大8v
 
-  // 检测轮子差速，判断轮子是否离地
-  if (uint64_t current_time = millis(); current_time - last_speed_record_time >= SPEED_RECORD_INTERVAL) {
-    robot_speed_diff = LQR_speed - last_lqr_speed;
-    // 轮子离地
-    if (robot_speed_diff > 18.0) {
-    }
-    if (robot_speed_diff < -9.0) {
-      // 轮子着地
-      if (jump_flag) {
-        // 落地点作为新的位移零点
-        resetZeroPoint();
-      }
-      if (jump_flag == 0) {
-        // 大减速运动状态手柄震动
-      }
-    }
-    last_lqr_speed = LQR_speed;            // 每隔100ms更新一次历史转速
-    last_speed_record_time = current_time; // 更新记录时间
+  // 离地时停止累计位移，落地点作为新的位移零点
+  if (contact.lifted_off() || contact.landed()) {
+    resetZeroPoint();
   }
 
   // 重置位移零点和积分情形
-  // 1.判断摇杆是否没有前后左右运动指令
-  if ((joyx_last != 0 && joyx == 0) || (joyy_last != 0 && joyy == 0)) {
+  // 1.前后左右运动参考值刚减到0、停稳
+  const bool driving = setpoint.driving();
+  const bool turning = setpoint.turning();
+  if ((driving_last && !driving) || (turning_last && !turning)) {
     resetZeroPoint();
   }
+  driving_last = driving;
+  turning_last = turning;
 
   // 2. 运动中实时重置位移零点和积分情形
-  if (abs(robot_speed_diff) > 10 || abs(LQR_speed) > 15 || joyy != 0) {
-    // 这两种是启动后自平衡，速度较快
+  if (abs(robot_speed_diff) > 10 || abs(LQR_speed) > 15 || driving || slip.slipping()) {
+    // 这两种是启动后自平衡，速度较快；打滑时轮部位移也不可信
     resetZeroPoint();
   }
 
   distance_control = pid_distance(LQR_distance - distance_zeropoint);
 
   // 计算 LQR_u
-  // 必须是在跳跃时jump_flag > 0，LQR_u= 角度控制量 + 角速度控制量
-  if (jump_flag > 0 and jump_flag < 120) {
-    // jump_flag：100离地 120着地
-    LQR_u = angle_control + gyro_control; // 角度控制量 + 角速度控制，位移和速度控制分量被忽略
+  // 跳跃的蹬腿、腾空、缓冲阶段位移环失去意义；按着地、腾空查表，在电压限制内同时照顾姿态和轮速
+  if (jump.mpc()) {
+    const float state[3] = {
+      pitch_error - disturbance.pitch_offset(), LQR_gyro, LQR_speed
+    };
+    LQR_u = (contact.grounded() ? jump_stance_mpc : jump_flight_mpc).evaluate(state);
+  }
+  else if (!contact.grounded()) {
+    // 被拿起：位移、速度环会让轮子空转飞车，只保留姿态项并限幅；放回地面后轮子带载即判定着地
+    LQR_u = constrain(angle_control + gyro_control, -AIRBORNE_EFFORT_LIMIT, AIRBORNE_EFFORT_LIMIT);
   }
   else {
     // 当轮部未离地时，LQR_u：4个参数
     // 当轮部未离地时，LQR_u =角度控制量+角速度控制量+位移控制量+速度控制量
     LQR_u = angle_control + gyro_control + distance_control + speed_control;
+    // 补偿斜坡、摩擦等轮部外力；跳跃中估计值保持起跳前的结果
+    LQR_u += disturbance.effort();
   }
 
-  // 小车没有控制的时候自稳定状态
-  // 控制量lqr_u<5V，前进后退控制量很小， 遥控器无信号输入joyy=0，轮部位移控制正常介入distance_control<4，不处于跳跃后的恢复时期jump_flag=0,以及不是坐下状态
-  if (abs(LQR_u) < 5 && joyy == 0 && abs(distance_control) < 4 && jump_flag == 0) {
-    LQR_u = pid_lqr_u(LQR_u);                                          // 小转矩非线性补偿
-    pitch_zeropoint -= pid_zeropoint(lpf_zeropoint(distance_control)); // 重心自适应
-  }
-  else {
-    pid_lqr_u.error_prev = 0; // 输出积分清零
+  // 打滑时限制输出变化率：力矩突变只会让轮子继续空转，慢慢加上去才能重新咬住地面
+  if (slip.slipping()) {
+    const float max_step = SLIP_EFFORT_SLEW * BALANCE_LOOP_INTERVAL / 1000.0f;
+    LQR_u = constrain(LQR_u, last_u - max_step, last_u + max_step);
   }
 
-  // 平衡控制参数自适应
-  // 考虑 leg_height_base = 0
-  if (uint8_t height = robot_leg_get_height_percentage(); height < 50) {
+  // 平衡控制参数自适应：质心越高，速度环增益越低，按质心高度连续插值；几何未实测时按腿高分段
+  if (kinematics_measured) {
+    pid_speed.P = mapf(kinematics.com_height, nominal_kinematics.com_height, high_kinematics.com_height, 0.7f, 0.5f);
+    pid_speed.P = constrain(pid_speed.P, 0.5f, 0.7f);
+  }
+  else if (const uint8_t height = robot_leg_get_height_percentage(); height < NOMINAL_HEIGHT_PERCENTAGE) {
     pid_speed.P = 0.7;
   }
-  else if (height < 64) {
+  else if (height < HIGH_HEIGHT_PERCENTAGE) {
     pid_speed.P = 0.6;
   }
   else {
@@ -276,30 +548,68 @@ void lqr_controller::balance_loop() {
 
 }
 
+// 横滚自平衡：根据横滚角调整左右腿高度差，使车身保持水平
+void lqr_controller::roll_loop(const float dt) {
+  ROLL_angle = lpf_roll(attitude_get_roll()); // 姿态由平衡环更新，这里只读取
+
+  // 跳跃中腿部动作由跳跃流程控制
+  if (jump.active()) {
+    return;
+  }
+
+  // 腿高差需要一直保持才能抵消地面倾斜，因此对横滚角积分：
+  // 死区外按 pid_roll_angle 的输出（%/s）逐步调整，车身放平后偏移保持不变
+  if (abs(ROLL_angle) > ROLL_DEADBAND) {
+    roll_offset += pid_roll_angle(ROLL_angle) * dt;
+    roll_offset = constrain(roll_offset, -ROLL_OFFSET_LIMIT, ROLL_OFFSET_LIMIT);
+    robot_leg_set_height_offset(leg_offset_roll, roll_offset, -roll_offset);
+  }
+}
+
 void lqr_controller::yaw_loop() {
-  // 跳跃中，YAW_output 设为0，避免干扰左右旋转
-  if (jump_flag) {
+  // 航向估计：陀螺仪积分，着地时用左右轮差速校正零偏；跳跃中也要继续积分
+  const float odometry = K_WHEEL_YAW_RATE * (motor_L.shaft_velocity - motor_R.shaft_velocity);
+  heading.update(BALANCE_LOOP_INTERVAL / 1000.0f, attitude_get_gyroscope()->z, odometry, contact.grounded() && !jump.active());
+  YAW_angle = heading.heading();
+  YAW_gyro = heading.rate(); // 左右偏航角速度，用于纠正小车前后走直线时的角度偏差
+
+  // 转弯侧倾前馈：按实测速度和偏航角速度提前调整左右腿高差，横滚环只需修正剩余偏差
+  robot_leg_plan_t plan;
+  const float height = robot_leg_get_plan(&plan) ? plan.height : robot_leg_get_height_percentage();
+  const float speed = LQR_speed * WHEEL_RADIUS;
+  turn_lean.update(BALANCE_LOOP_INTERVAL / 1000.0f, speed, YAW_gyro, height, contact.grounded() && !jump.active());
+  if (fabsf(turn_lean.leg_offset() - turn_offset) > TURN_OFFSET_STEP) {
+    turn_offset = turn_lean.leg_offset();
+    robot_leg_set_height_offset(leg_offset_turn, turn_offset, -turn_offset);
+  }
+
+  // 蹬腿、腾空、缓冲阶段 YAW_output 设为0，避免干扰左右旋转
+  if (!jump.yaw()) {
     YAW_output = 0;
+    heading_hold = false;
     return;
   }
 
-  // 1. 根据abs(joyx)，动态设置yaw_target系数
-  float coeff = mapf(static_cast<float>(abs(joyx)), 0, 100, 0.1f, 1.0f);
-
-  coeff = constrain(coeff, 0.1f, 1.0f);
-  float yaw_target = static_cast<float>(joyx) * coeff;
+  // 1. 转向参考值（°/s）折算成转向电压；边走边转时向心加速度不超过当前腿高允许的上限
+  float yaw_rate = setpoint.yaw_rate();
+  if (fabsf(speed) > MIN_CORNERING_SPEED) {
+    const float max_yaw_rate = turn_lean.max_lateral_acceleration() / fabsf(speed) * 57.2957795f;
+    yaw_rate = constrain(yaw_rate, -max_yaw_rate, max_yaw_rate);
+  }
+  float yaw_target = K_YAW_RATE_VOLTAGE * yaw_rate;
 
-  // 2. 根据abs(joyx)，提高PID响应：临时放大yaw_angle_control（核心突破上限）
+  // 2. 原地打转时提高PID响应：临时放大yaw_angle_control（核心突破上限）
   float yaw_angle_control_coeff = 1.0f;
-  if (joyy == 0 && abs(joyx) > 10) {
+  if (!setpoint.driving() && fabsf(yaw_rate) > SPIN_YAW_RATE) {
     // 原地打转
-    yaw_angle_control_coeff = mapf(static_cast<float>(abs(joyx)), 0, 100, 1.0, 2.0);
+    const float spin = fabsf(yaw_rate) / YAW_RATE_MAX * 100.0f;
+    yaw_angle_control_coeff = mapf(spin, 0, 100, 1.0, 2.0);
     // 根据转向速度，智能计算height
-    // abs(joyx) 范围0到100，默认0，输出范围20-50,默认 30
-    // 反向映射：绝对值30→60，绝对值100→0（线性过渡）
+    // 转速百分比 0到100，输出范围 30-50
+    // 反向映射：转得越快，车身越低（线性过渡）
 
-    int height = mapi(abs(joyx), 0, 100, 50, 30);
-    // 强制约束输出在0~60范围内（防止异常值）
+    int height = mapi(static_cast<int>(spin), 0, 100, 50, 30);
+    // 强制约束输出在30~50范围内（防止异常值）
     height = constrain(height, 30, 50);
     // 使用低波过滤器，平滑数据
 
@@ -313,9 +623,19 @@ void lqr_controller::yaw_loop() {
   // 限制yaw_angle_control上限，避免超压（按电机7.4V反推，设为12较合适）
   yaw_angle_control = constrain(yaw_angle_control, -12.0f, 12.0f);
 
-  YAW_gyro = attitude_get_gyroscope()->z; // 左右偏航角速度，用于纠正小车前后走直线时的角度偏差
   float yaw_gyro_control = pid_yaw_gyro(YAW_gyro);
-  YAW_output = yaw_angle_control + yaw_gyro_control;
+
+  // 3. 航向保持：松开转向摇杆、转速降下来后锁定当前航向，之后按航向偏差纠正，走直线不再跑偏
+  if (setpoint.turning() || !contact.grounded()) {
+    heading_hold = false;
+  }
+  else if (!heading_hold && fabsf(YAW_gyro) < HEADING_LOCK_RATE) {
+    heading_hold = true;
+    YAW_angle_zero_point = YAW_angle;
+  }
+  const float heading_control = heading_hold ? pid_yaw_heading(YAW_angle - YAW_angle_zero_point) : 0.0f;
+
+  YAW_output = yaw_angle_control + yaw_gyro_control + heading_control;
 }
 
 void lqr_controller::stop() {
@@ -325,21 +645,138 @@ void lqr_controller::stop() {
   motor_L.disable();
   motor_R.disable();
 
+  if (const eTaskState state = eTaskGetState(roll_task_handle); state != eSuspended) {
+    vTaskSuspend(roll_task_handle);
+  }
+  roll_offset = 0;
+  robot_leg_set_height_offset(leg_offset_roll, 0, 0);
+  turn_lean.reset();
+  turn_offset = 0;
+  robot_leg_set_height_offset(leg_offset_turn, 0, 0);
+
   if (const eTaskState state = eTaskGetState(task_handle); state != eSuspended) {
     vTaskSuspend(task_handle);
   }
+  // 平衡环已挂起，跳跃到一半停下时腿交还轨迹规划
+  jump_requested = false;
+  if (jump.active()) {
+    jump.abort();
+    robot_leg_release_direct(lroundf(jump.start_height()));
+  }
 }
 
 void lqr_controller::start() {
   log_info("start");
+  if (calibration_task_handle != nullptr) {
+    log_warn("motor calibration running, start ignored");
+    return;
+  }
   if (const eTaskState state = eTaskGetState(task_handle); state == eSuspended) {
+    estimator.reset();
+    distance_rebase = true;
+    contact.reset();
+    slip.reset();
+    disturbance.reset();
+    heading.reset();
+    heading_hold = false;
+    setpoint.reset();
 
     motor_L.enable();
     motor_R.enable();
 
     vTaskResume(task_handle);
   }
+  if (const eTaskState state = eTaskGetState(roll_task_handle); state == eSuspended) {
+    vTaskResume(roll_task_handle);
+  }
+
+}
+
+void lqr_controller::set_joy(const int8_t x, const int8_t y) {
+  // 前进、后退满量程速度不同，但在0处连续，不会在换向时跳变
+  const float speed = static_cast<float>(y) / 100.0f * (y > 0 ? MAX_FORWARD_SPEED : MAX_BACKWARD_SPEED);
+
+  // 转向手感：小幅度推杆转得慢，便于微调，按 abs(x) 动态设置系数
+  float coeff = mapf(static_cast<float>(abs(x)), 0, 100, 0.1f, 1.0f);
+  coeff = constrain(coeff, 0.1f, 1.0f);
+  float yaw_rate = static_cast<float>(x) * coeff / K_YAW_RATE_VOLTAGE;
+  yaw_rate = constrain(yaw_rate, -YAW_RATE_MAX, YAW_RATE_MAX);
+
+  setpoint.command(speed, yaw_rate, millis());
+}
+
+void lqr_controller::set_wheel_commands(const float left, const float right) {
+  // 左轮比右轮快为向右转，与摇杆 x 正数同向
+  const float speed = constrain(0.5f * (left + right), -MAX_BACKWARD_SPEED, MAX_FORWARD_SPEED);
+  const float yaw_rate = constrain(differential_drive::yaw_rate(left, right, WHEEL_TRACK), -YAW_RATE_MAX, YAW_RATE_MAX);
+  setpoint.command(speed, yaw_rate, millis());
+}
+
+void lqr_controller::request_jump() {
+  if (eTaskGetState(task_handle) == eSuspended) {
+    log_warn("jump ignored: balance stopped");
+    return;
+  }
+  if (jump.active() || jump_requested) {
+    log_warn("jump ignored: already jumping");
+    return;
+  }
+  // 起跳前必须站稳：着地、不打滑、没有移动指令，腿部轨迹也已走完
+  robot_leg_plan_t plan;
+  if (!contact.grounded() || slip.slipping() || setpoint.driving() || setpoint.turning()
+      || (robot_leg_get_plan(&plan) && plan.velocity != 0)) {
+    log_warn("jump ignored: not standing still");
+    return;
+  }
+  log_info("jump");
+  jump_requested = true;
+}
+
+// 电机标定（齿槽补偿表、KV 辨识）：轮子需悬空，耗时约一分钟，期间平衡环停止，结束后保持停止状态
+void lqr_controller::calibrate_motors() {
+  if (calibration_task_handle != nullptr) {
+    log_warn("motor calibration already running");
+    return;
+  }
+  stop();
+  xTaskCreatePinnedToCore(motor_calibration_task, "motor_cal", 4096, this, 10, &calibration_task_handle, balance_CORE);
+}
+
+static void motor_calibration_task(void* pvParameters) {
+  log_info("motor calibration started");
+
+  BLDCMotor* motors[] = { &motor_L, &motor_R };
+  const char* cogging_keys[] = { COGGING_KEY_L, COGGING_KEY_R };
+  const char* kv_keys[] = { KV_KEY_L, KV_KEY_R };
+  for (int i = 0; i < 2; i++) {
+    BLDCMotor& motor = *motors[i];
+    motor.enable();
+    if (motor.calibrateCogging(COGGING_HOLDING_VOLTAGE)) {
+      if (!motor.cogging_compensation.save(cogging_keys[i])) {
+        log_error("cogging table save failed: %s", cogging_keys[i]);
+      }
+    }
+    else {
+      log_error("cogging calibration failed: %s", cogging_keys[i]);
+    }
+
+    if (motor.identifyKV(KV_IDENT_VOLTAGE)) {
+      if (storage_save(MOTOR_NVS_NAMESPACE, kv_keys[i], &motor.KV_rating, sizeof(motor.KV_rating))) {
+        motor.phase_resistance = PHASE_RESISTANCE_NORMALIZED;
+      }
+      else {
+        log_error("KV save failed: %s", kv_keys[i]);
+      }
+    }
+    else {
+      log_error("KV identification failed: %s", kv_keys[i]);
+    }
+    motor.disable();
+  }
 
+  log_info("motor calibration finished");
+  calibration_task_handle = nullptr;
+  vTaskDelete(nullptr);
 }
 
 bool lqr_controller::is_started() {
@@ -15,9 +15,16 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include "defs.h"
+#include "robot/contact_estimator.hpp"
+#include "robot/disturbance_observer.hpp"
+#include "robot/heading_estimator.hpp"
+#include "robot/jump_sequencer.hpp"
+#include "robot/slip_estimator.hpp"
 
 class lqr_controller {
 
@@ -30,14 +37,38 @@ public:
   void resetZeroPoint();
   void balance_loop();
   void yaw_loop();
+  void roll_loop(float dt);
 
   void stop();
   void start();
 
+  void calibrate_motors();
+
+  /**
+   * @brief 摇杆指令，经整形后作为速度、转向参考值
+   * @param x 左右转向（-100~100），正面看，正数：向左转，负数，向右转
+   * @param y 前后移动（-100~100），正数前进
+   */
+  void set_joy(int8_t x, int8_t y);
+
+  /**
+   * @brief 速度指令：左右轮线速度换算成线速度、偏航角速度参考值，与摇杆共用同一套整形
+   * @param left 左轮线速度（m/s），正数前进
+   * @param right 右轮线速度（m/s），正数前进
+   */
+  void set_wheel_commands(float left, float right);
+
+  /**
+   * @brief 请求跳跃，下一个控制周期开始执行；未启动、未站稳或正在移动时忽略
+   */
+  void request_jump();
+
   bool is_started();
 
 private:
   TaskHandle_t task_handle = nullptr;
+  TaskHandle_t roll_task_handle = nullptr;
+  std::atomic<bool> jump_requested{ false };
 
 public:
   // LQR自平衡控制器参数
@@ -55,47 +86,31 @@ public:
   float original_pitch_zeropoint = pitch_zeropoint; // 保存原始的角度零点
   float distance_zeropoint = 0.5f;                  // 轮部位移零点偏置
   float pitch_adjust = 0.0f;                        // 俯仰角度调整,负数前倾，正数后倾
+  float pitch_feedforward = 0.0f;                   // 腿高改变质心位置带来的零点变化（运动学查表前馈）
 
-  // 记录轮部转速，用于判断跳跃状态
-  unsigned long last_speed_record_time = 0;        // 上次记录转速的时间
-  const unsigned long SPEED_RECORD_INTERVAL = 100; // 转速记录间隔(毫秒) ，因为时间相隔太近速度差不明显的
+  // 着地检测，每个控制周期更新
+  ContactEstimator contact;
+  float robot_speed_diff = 0; // 轮部速度变化（折算到 100ms）
 
-  float last_lqr_speed = 0;   // 记录上一时刻的轮部转速
-  float robot_speed_diff = 0; // 速度差
+  // 打滑检测，打滑时速度环改用融合的车身速度
+  SlipEstimator slip;
 
   // YAW轴控制数据
-  float YAW_gyro = 0;
-  float YAW_angle = 0;
-  float YAW_angle_last = 0;
-  float YAW_angle_total = 0;
-  float YAW_angle_zero_point = -10;
+  HeadingEstimator heading;
+  float YAW_gyro = 0;             // 扣除零偏后的偏航角速度，单位：°/s
+  float YAW_angle = 0;            // 航向，单位：°
+  float YAW_angle_zero_point = 0; // 航向保持的目标航向，单位：°
+  bool heading_hold = false;      // 是否处于航向保持
   float YAW_output = 0;
 
-  // 跳跃相关参数
-  int jump_flag = 0; // 跳跃过程计数
-
-  int8_t joyx = 0; // 前后移动（-100~100）
-  int8_t joyy = 0; // 左右转向（-100~100），正面看，正数：向左转，负数，向右转
+  // ROLL轴控制数据
+  float ROLL_angle = 0;  // 滤波后的横滚角，单位：°
+  float roll_offset = 0; // 左右腿高度差的一半，单位：%，左腿加、右腿减
 
-  int8_t joyx_last = 0;
-  int8_t joyy_last = 0;
-
-
-  // 新增目标值
-  float target_linear_speed; // 期望线速度（单位需与编码器一致）
-  float target_yaw_rate;     // 期望偏航角速度（单位需与陀螺仪一致）
-
-  // 新增接口：由外部设置左右轮指令
-  void set_wheel_commands(float left, float right) {
-    // 可在此处添加缩放、死区处理
-    float left_scaled = left * 0.01f; // 假设摇杆范围-100~100，映射到实际速度
-    float right_scaled = right * 0.01f;
-    target_linear_speed = (left_scaled + right_scaled) * 0.5f;
-    target_yaw_rate = (right_scaled - left_scaled) * TURN_GAIN; // TURN_GAIN 根据实测确定
-  }
-
-private:
-  static constexpr float TURN_GAIN = 2.0f;   // 示例值，需实际标定
-  static constexpr float SPEED_SCALE = 1.0f; // 速度缩放系数
+  // 跳跃动作，按阶段表在平衡环中逐拍执行
+  JumpSequencer jump;
 
+  // 遥控指令整形后的参考值是否在变化，用于在起步、停稳时重置位移零点
+  bool driving_last = false;
+  bool turning_last = false;
 };
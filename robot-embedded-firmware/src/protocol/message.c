@@ -24,8 +24,8 @@ static uint16_t get_next_sequence() {
 }
 
 static bool serialize_control_message(const control_message_t* control, buffer_t* buf) {
-  return buffer_write_u16(buf, control->left_wheel_speed)
-         && buffer_write_u16(buf, control->right_wheel_speed);
+  return buffer_write_i16(buf, control->left_wheel_speed)
+         && buffer_write_i16(buf, control->right_wheel_speed);
 }
 
 static bool serialize_body(robot_message_t* msg, buffer_t* buf) {
@@ -48,8 +48,8 @@ bool robot_message_serialize(robot_message_t* msg, buffer_t* buf) {
 // deserialize
 
 static bool deserialize_control_message(control_message_t* control, buffer_t* buf) {
-  return buffer_read_u16(buf, &control->left_wheel_speed)
-         && buffer_read_u16(buf, &control->right_wheel_speed);
+  return buffer_read_i16(buf, &control->left_wheel_speed)
+         && buffer_read_i16(buf, &control->right_wheel_speed);
 }
 
 static bool deserialize_control_leg_message(control_leg_message_t* control, buffer_t* buf) {
@@ -63,10 +63,17 @@ static bool deserialize_config_pid(config_pid_message_t* pid, buffer_t* buf) {
          && buffer_read_f32(buf, &pid->D);
 }
 
+static bool deserialize_config_shaper(config_shaper_message_t* shaper, buffer_t* buf) {
+  return buffer_read_f32(buf, &shaper->frequency)
+         && buffer_read_f32(buf, &shaper->damping);
+}
+
 static bool deserialize_config_body(config_message_t* config, buffer_t* buf) {
   switch (config->type) {
     case PID_SPEED:
     case PID_PITCH: return deserialize_config_pid(&config->data.pid, buf);
+    case SUSPENSION: return buffer_read_i8(buf, &config->data.i8);
+    case SHAPER: return deserialize_config_shaper(&config->data.shaper, buf);
 
     default:
       break;
@@ -89,17 +96,23 @@ static bool deserialize_control_joy_message(control_joy_message_t* joy, buffer_t
          && buffer_read_i8(buf, &joy->y);
 }
 
+static bool deserialize_action_play_message(action_play_message_t* action_play, buffer_t* buf) {
+  return buffer_read_u8(buf, (uint8_t*) &action_play->action);
+}
+
 static bool deserialize_body(robot_message_t* msg, buffer_t* buf) {
   switch (msg->type) {
     case MESSAGE_CONTROL: return deserialize_control_message(&msg->control, buf);
     case MESSAGE_CONTROL_LEG: return deserialize_control_leg_message(&msg->control_leg, buf);
     case MESSAGE_CONTROL_HEIGHT: return deserialize_control_height_message(&msg->height, buf);
     case MESSAGE_CONTROL_JOY: return deserialize_control_joy_message(&msg->control_joy, buf);
+    case MESSAGE_ACTION_PLAY: return deserialize_action_play_message(&msg->action_play, buf);
 
     case MESSAGE_CONFIG_GET: return deserialize_config_message(&msg->config, buf);
     case MESSAGE_CONFIG_SET: return deserialize_config_message(&msg->config, buf);
     case MESSAGE_EMERGENCY_STOP:
-    case MESSAGE_EMERGENCY_RECOVER: return true; // no body
+    case MESSAGE_EMERGENCY_RECOVER:
+    case MESSAGE_MOTOR_CALIBRATE: return true; // no body
 
     default:
       break;
@@ -122,6 +135,7 @@ const char* message_type_to_string(const message_type_t type) {
     case MESSAGE_CONTROL_JOY: return "CONTROL_JOY";
     case MESSAGE_EMERGENCY_STOP: return "EMERGENCY_STOP";
     case MESSAGE_EMERGENCY_RECOVER: return "EMERGENCY_RECOVER";
+    case MESSAGE_MOTOR_CALIBRATE: return "MOTOR_CALIBRATE";
     case MESSAGE_CONFIG_SET: return "CONFIG_SET";
     case MESSAGE_CONFIG_GET: return "CONFIG_GET";
     case MESSAGE_FIRMWARE_INFO: return "FIRMWARE_INFO";
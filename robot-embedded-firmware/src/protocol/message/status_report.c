@@ -22,6 +22,12 @@ static bool serialize_body(status_report_t* msg, buffer_t* buf) {
              && buffer_write_u8(buf, msg->battery.percentage);
     }
     case status_robot_height: return buffer_write_u8(buf, msg->robot_height.percentage);
+    case status_odometry: {
+      return buffer_write_f32(buf, msg->odometry.x)
+             && buffer_write_f32(buf, msg->odometry.y)
+             && buffer_write_f32(buf, msg->odometry.heading)
+             && buffer_write_f32(buf, msg->odometry.distance);
+    }
   }
   return false;
 }
@@ -38,6 +44,12 @@ static bool deserialize_body(status_report_t* msg, buffer_t* buf) {
              && buffer_read_u8(buf, &msg->battery.percentage);
     }
     case status_robot_height: return buffer_read_u8(buf, &msg->robot_height.percentage);
+    case status_odometry: {
+      return buffer_read_f32(buf, &msg->odometry.x)
+             && buffer_read_f32(buf, &msg->odometry.y)
+             && buffer_read_f32(buf, &msg->odometry.heading)
+             && buffer_read_f32(buf, &msg->odometry.distance);
+    }
   }
   return false;
 }
@@ -15,8 +15,10 @@
 
 #include "robot.hpp"
 #include "robot/leg.h"
+#include "robot/odometry.h"
 #include "robot/error.h"
 #include "robot/stats.h"
+#include "robot/suspension.h"
 
 #include "battery.hpp"
 #include "logging.hpp"
@@ -80,6 +82,20 @@ static void status_report_task(void* param) {
   }
 }
 
+static void handle_config_message(const config_message_t* config) {
+  switch (config->type) {
+    case SUSPENSION:
+      robot_suspension_set_enabled(config->data.i8 != 0);
+      break;
+    case SHAPER:
+      robot_leg_set_shaper(config->data.shaper.frequency, config->data.shaper.damping);
+      break;
+    default:
+      log_warn("unsupported config: %u", config->type);
+      break;
+  }
+}
+
 static void handle_robot_message(robot_message_t* message) {
   switch (message->type) {
     case MESSAGE_CONTROL: {
@@ -102,12 +118,21 @@ static void handle_robot_message(robot_message_t* message) {
       robot_set_height(message->height.percentage);
       break;
     }
+    case MESSAGE_ACTION_PLAY:
+      robot_play_action(message->action_play.action);
+      break;
+    case MESSAGE_CONFIG_SET:
+      handle_config_message(&message->config);
+      break;
     case MESSAGE_EMERGENCY_STOP:
       robot_stop();
       break;
     case MESSAGE_EMERGENCY_RECOVER:
       robot_recover();
       break;
+    case MESSAGE_MOTOR_CALIBRATE:
+      robot_calibrate_motors();
+      break;
     default:
       break;
   }
@@ -168,9 +193,11 @@ void robot_init() {
   serial.begin(115200);
 
   robot_leg_init();
+  robot_suspension_init();
   battery_init();
 
   lqr_controller.begin();
+  robot_odometry_init();
   lqr_controller.stop();
 
   controller_init(on_data_received, conn_state_change);
@@ -179,6 +206,17 @@ void robot_init() {
   xTaskCreate(robot_message_parsing_task, "rm", 4096, nullptr, 8, nullptr);
 }
 
+void robot_play_action(const uint8_t action) {
+  switch (action) {
+    case ACTION_JUMP:
+      lqr_controller.request_jump();
+      break;
+    default:
+      log_warn("unknown action: %u", action);
+      break;
+  }
+}
+
 void robot_stop() {
   lqr_controller.stop();
 }
@@ -187,6 +225,10 @@ void robot_recover() {
   lqr_controller.start();
 }
 
+void robot_calibrate_motors() {
+  lqr_controller.calibrate_motors();
+}
+
 bool robot_controller_is_connected() {
   return controller_is_connected();
 }
@@ -195,11 +237,10 @@ void robot_set_height(const uint8_t percentage) {
   robot_leg_set_height_percentage(percentage);
 }
 
-void robot_set_speed(uint16_t left_wheel_speed, uint16_t right_wheel_speed) {
-
+void robot_set_speed(const int16_t left_wheel_speed, const int16_t right_wheel_speed) {
+  lqr_controller.set_wheel_commands(left_wheel_speed / 1000.0f, right_wheel_speed / 1000.0f);
 }
 
 void robot_set_joy(int8_t x, int8_t y) {
-  lqr_controller.joyx = x;
-  lqr_controller.joyy = y;
+  lqr_controller.set_joy(x, y);
 }
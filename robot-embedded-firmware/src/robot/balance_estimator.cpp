@@ -0,0 +1,97 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "balance_estimator.hpp"
+
+// 过程噪声：加速度白噪声的功率谱密度
+#define PITCH_ACCELERATION_NOISE 100000.0f // (°/s²)²/Hz
+#define WHEEL_ACCELERATION_NOISE 500.0f   // (rad/s²)²/Hz
+
+// 观测噪声方差
+#define ACCEL_PITCH_VARIANCE 9.0f      // 加速度计俯仰角受轮部加速度干扰，约 3°
+#define GYRO_VARIANCE 0.25f            // 约 0.5°/s
+#define DISTANCE_VARIANCE 0.000004f    // AS5600 12 位分辨率，约 0.002rad
+
+BalanceEstimator::BalanceEstimator() {
+  reset();
+}
+
+void BalanceEstimator::reset() {
+  initialized_ = false;
+  x_ = Vector<STATES>::zeros();
+  P_ = Matrix<STATES, STATES>::zeros();
+}
+
+void BalanceEstimator::update(const float dt, const float accel_pitch, const float gyro, const float distance) {
+  if (!initialized_) {
+    reset();
+    x_[PITCH] = accel_pitch;
+    x_[PITCH_RATE] = gyro;
+    x_[DISTANCE] = distance;
+    P_(PITCH, PITCH) = ACCEL_PITCH_VARIANCE;
+    P_(PITCH_RATE, PITCH_RATE) = GYRO_VARIANCE;
+    P_(DISTANCE, DISTANCE) = DISTANCE_VARIANCE;
+    P_(SPEED, SPEED) = 100.0f;
+    initialized_ = true;
+    return;
+  }
+
+  predict(dt);
+  correct(PITCH_RATE, gyro, GYRO_VARIANCE);
+  correct(PITCH, accel_pitch, ACCEL_PITCH_VARIANCE);
+  correct(DISTANCE, distance, DISTANCE_VARIANCE);
+}
+
+void BalanceEstimator::predict(const float dt) {
+  // F 为两组 [1 dt; 0 1] 的分块对角阵
+  auto F = Matrix<STATES, STATES>::identity();
+  F(PITCH, PITCH_RATE) = dt;
+  F(DISTANCE, SPEED) = dt;
+
+  // 连续白噪声加速度离散化：q [dt³/3 dt²/2; dt²/2 dt]
+  const float dt2 = dt * dt;
+  const float dt3 = dt2 * dt;
+  auto Q = Matrix<STATES, STATES>::zeros();
+  constexpr float noise[2] = { PITCH_ACCELERATION_NOISE, WHEEL_ACCELERATION_NOISE };
+  for (int block = 0; block < 2; block++) {
+    const int p = block * 2;
+    const float q = noise[block];
+    Q(p, p) = q * dt3 / 3;
+    Q(p, p + 1) = q * dt2 / 2;
+    Q(p + 1, p) = q * dt2 / 2;
+    Q(p + 1, p + 1) = q * dt;
+  }
+
+  x_ = F * x_;
+  P_ = F * P_ * F.transpose() + Q;
+}
+
+void BalanceEstimator::correct(const uint8_t state, const float z, const float r) {
+  // H 只在 state 处为 1：S = H P Hᵀ + r，K = P Hᵀ / S
+  auto H = Matrix<1, STATES>::zeros();
+  H[state] = 1.0f;
+
+  const Vector<STATES> PHt = P_ * H.transpose();
+  const float S = (H * PHt)[0] + r;
+  if (S <= 0) {
+    return;
+  }
+
+  const Vector<STATES> K = PHt / S;
+  x_ += K * (z - x_[state]);
+  P_ -= K * (H * P_);
+  P_.symmetrize();
+}
@@ -0,0 +1,90 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+#include "foc/common/matrix.h"
+
+/**
+ * @brief 平衡状态估计（线性卡尔曼滤波）
+ *
+ * 状态：俯仰角（°）、俯仰角速度（°/s）、轮部位移（rad）、轮部速度（rad/s）。
+ * 过程模型为匀速模型，角加速度、轮部加速度作为白噪声；
+ * 观测为加速度计俯仰角、陀螺仪 Y 轴角速度、两个编码器的位移。
+ * 观测噪声互不相关，逐个标量更新，不需要矩阵求逆；矩阵维度在编译期确定，不分配堆内存。
+ */
+class BalanceEstimator {
+public:
+  enum : uint8_t {
+    PITCH = 0,
+    PITCH_RATE,
+    DISTANCE,
+    SPEED,
+    STATES
+  };
+
+  BalanceEstimator();
+
+  /** @brief 丢弃当前估计，下一次 update 时以观测值重新初始化 */
+  void reset();
+
+  /**
+   * @brief 预测并融合一帧观测
+   * @param dt 距上一帧的时间（秒）
+   * @param accel_pitch 加速度计算出的俯仰角（°）
+   * @param gyro 俯仰角速度（°/s）
+   * @param distance 轮部位移（rad）
+   */
+  void update(float dt, float accel_pitch, float gyro, float distance);
+
+  float pitch() const {
+    return x_[PITCH];
+  }
+
+  float pitch_rate() const {
+    return x_[PITCH_RATE];
+  }
+
+  float distance() const {
+    return x_[DISTANCE];
+  }
+
+  /** @brief 位移原点前移 offset（rad），位移状态随之平移，速度和协方差不变 */
+  void shift_distance(const float offset) {
+    x_[DISTANCE] -= offset;
+  }
+
+  float speed() const {
+    return x_[SPEED];
+  }
+
+  /** @brief 状态协方差 */
+  const Matrix<STATES, STATES>& covariance() const {
+    return P_;
+  }
+
+private:
+  /** @brief 匀速模型预测：x = F x，P = F P Fᵀ + Q */
+  void predict(float dt);
+
+  /** @brief 直接观测某一状态量的标量更新 */
+  void correct(uint8_t state, float z, float r);
+
+  bool initialized_;
+  Vector<STATES> x_;
+  Matrix<STATES, STATES> P_;
+};
@@ -0,0 +1,85 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "contact_estimator.hpp"
+
+#include <cmath>
+
+#define FREEFALL_ACCELERATION 0.4f     // 低于该值视为失重，单位：g
+#define IMPACT_ACCELERATION 1.8f       // 高于该值视为落地冲击，单位：g
+#define STEADY_ACCELERATION_MIN 0.7f   // 着地时加速度模长的正常范围，单位：g
+#define STEADY_ACCELERATION_MAX 1.3f
+#define EFFORT_MIN 0.5f                // 输出低于该值时不用加速度/输出比判断，单位：V
+#define FREE_WHEEL_RATIO 150.0f        // 轮部角加速度/输出高于该值视为空转，单位：(rad/s²)/V
+#define NO_LOAD_SPEED_RATIO 12.5f      // 空载转速/输出，即反电动势常数 0.08V/(rad/s) 的倒数，单位：(rad/s)/V
+#define LOADED_SPEED_FRACTION 0.3f     // 轮速低于空载转速的该比例视为被地面拖住
+#define LOAD_DECELERATION 5.0f         // 轮子逆着输出方向减速超过该值视为被地面拖住，单位：rad/s²
+#define WHEEL_ACCELERATION_TF 0.02f    // 轮部角加速度低通滤波时间常数，单位：秒
+#define AIRBORNE_TICKS 3               // 连续多少个周期有离地证据才确认离地
+#define GROUNDED_TICKS 3               // 连续多少个周期轮子带载才确认着地（无冲击的轻放）
+
+void ContactEstimator::reset() {
+  state_ = GROUNDED;
+  previous_ = GROUNDED;
+  airborne_ticks_ = 0;
+  grounded_ticks_ = 0;
+  initialized_ = false;
+  wheel_speed_ = 0;
+  wheel_acceleration_ = 0;
+}
+
+void ContactEstimator::update(const float dt, const float acceleration, const float wheel_speed, const float effort) {
+  previous_ = state_;
+  if (!initialized_ || dt <= 0) {
+    wheel_speed_ = wheel_speed;
+    initialized_ = true;
+    return;
+  }
+
+  const float raw = (wheel_speed - wheel_speed_) / dt;
+  wheel_speed_ = wheel_speed;
+  const float alpha = dt / (WHEEL_ACCELERATION_TF + dt);
+  wheel_acceleration_ += alpha * (raw - wheel_acceleration_);
+
+  const bool freefall = acceleration < FREEFALL_ACCELERATION;
+  const bool impact = acceleration > IMPACT_ACCELERATION;
+  // 空转是顺着输出方向被甩起来；逆着输出减速是地面在拖轮子，不算空转
+  const bool free_wheel = fabsf(effort) > EFFORT_MIN
+                          && wheel_acceleration_ * effort > FREE_WHEEL_RATIO * effort * effort;
+
+  if (state_ == GROUNDED) {
+    airborne_ticks_ = (freefall || free_wheel) ? airborne_ticks_ + 1 : 0;
+    if (airborne_ticks_ >= AIRBORNE_TICKS) {
+      state_ = AIRBORNE;
+      airborne_ticks_ = 0;
+      grounded_ticks_ = 0;
+    }
+  }
+  else {
+    // 轻放需要真实的负载特征：电机有输出，轮速远低于该输出下的空载转速，或者轮子逆着输出减速。
+    // 只看加速度不大不够，空转到空载转速的轮子加速度同样接近零；没有输出时保持离地状态，等落地冲击
+    const bool stalled = fabsf(wheel_speed) < LOADED_SPEED_FRACTION * NO_LOAD_SPEED_RATIO * fabsf(effort);
+    const bool braking = wheel_acceleration_ * effort < 0 && fabsf(wheel_acceleration_) > LOAD_DECELERATION;
+    const bool loaded = fabsf(effort) > EFFORT_MIN && !free_wheel && (stalled || braking);
+    const bool steady = acceleration > STEADY_ACCELERATION_MIN && acceleration < STEADY_ACCELERATION_MAX && loaded;
+    grounded_ticks_ = steady ? grounded_ticks_ + 1 : 0;
+    if (impact || grounded_ticks_ >= GROUNDED_TICKS) {
+      state_ = GROUNDED;
+      airborne_ticks_ = 0;
+      grounded_ticks_ = 0;
+    }
+  }
+}
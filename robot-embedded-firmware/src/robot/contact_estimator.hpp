@@ -0,0 +1,85 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 着地/离地检测
+ *
+ * 每个控制周期更新一次，综合三类信号：
+ * - 加速度计模长：腾空时接近失重，落地瞬间有冲击；
+ * - 轮部角加速度与电机输出之比：着地时要推动整车，同样的电压只能带来很小的轮部加速度，
+ *   离地后只剩轮子本身的惯量，轮子会被迅速甩起来；
+ * - 电机输出本身：输出很小时上面的比值没有意义，不作为证据。
+ * 离地需要连续几个周期的证据；落地冲击立即确认，轻放则要等电机有输出且轮子带载时确认：
+ * 轮速远低于该输出下的空载转速，或者轮子逆着输出方向减速。空转到空载转速的轮子加速度也接近零，
+ * 不能当作带载。
+ */
+class ContactEstimator {
+public:
+  enum State : uint8_t {
+    GROUNDED = 0,
+    AIRBORNE,
+  };
+
+  ContactEstimator() = default;
+
+  /** @brief 回到着地状态并清空滤波器 */
+  void reset();
+
+  /**
+   * @brief 更新一个控制周期
+   * @param dt 周期（秒）
+   * @param acceleration 加速度计模长（g）
+   * @param wheel_speed 轮部速度（rad/s）
+   * @param effort 上一周期的电机输出（V）
+   */
+  void update(float dt, float acceleration, float wheel_speed, float effort);
+
+  State state() const {
+    return state_;
+  }
+
+  bool grounded() const {
+    return state_ == GROUNDED;
+  }
+
+  /** @brief 本周期刚刚离地 */
+  bool lifted_off() const {
+    return state_ == AIRBORNE && previous_ == GROUNDED;
+  }
+
+  /** @brief 本周期刚刚落地 */
+  bool landed() const {
+    return state_ == GROUNDED && previous_ == AIRBORNE;
+  }
+
+  /** @brief 滤波后的轮部角加速度（rad/s²） */
+  float wheel_acceleration() const {
+    return wheel_acceleration_;
+  }
+
+private:
+  State state_ = GROUNDED;
+  State previous_ = GROUNDED;
+  uint8_t airborne_ticks_ = 0;
+  uint8_t grounded_ticks_ = 0;
+  bool initialized_ = false;
+  float wheel_speed_ = 0;
+  float wheel_acceleration_ = 0;
+};
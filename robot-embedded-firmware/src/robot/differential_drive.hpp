@@ -0,0 +1,49 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+/**
+ * @brief 差速转向的符号约定
+ *
+ * 控制器里的偏航指令（摇杆 x、yaw_rate 参考值、YAW_output）正数为向右转：
+ * 左轮比右轮快。左右电机的目标在这里统一叠加，轮速指令换算也按同一个方向，
+ * 两处不会各写一套符号。
+ */
+namespace differential_drive {
+
+/**
+ * @brief 左右轮线速度换算成偏航指令
+ * @param left 左轮线速度（m/s）
+ * @param right 右轮线速度（m/s）
+ * @param track 轮距（米）
+ * @return 偏航角速度（°/s），正数向右转
+ */
+constexpr float yaw_rate(const float left, const float right, const float track) {
+  return (left - right) / track * 57.2957795f;
+}
+
+/** @brief 左轮的输出：前进量加上偏航量 */
+constexpr float left(const float forward, const float yaw) {
+  return forward + yaw;
+}
+
+/** @brief 右轮的输出：前进量减去偏航量 */
+constexpr float right(const float forward, const float yaw) {
+  return forward - yaw;
+}
+
+}
@@ -0,0 +1,94 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+
+#include "disturbance_observer.hpp"
+
+#include <cmath>
+
+#define GRAVITY 9.81f
+#define DEG_TO_RAD 0.0174532925f
+#define RAD_TO_DEG 57.2957795f
+
+// 名义模型参数：车身（含连杆）质量、两轮等效质量（含转动惯量）、车身绕自身质心的转动惯量
+#define BODY_MASS 0.58f       // kg，见 tools/leg_kinematics.py
+#define WHEEL_MASS 0.15f      // kg
+#define BODY_INERTIA 0.0015f // kg·m²
+// 两个电机每伏输出的总力矩，单位：N·m/V；稳态补偿与该值无关，只影响收敛过程
+#define TORQUE_PER_VOLT 0.02f
+
+#define FILTER_TF 0.5f          // 外力、外力矩估计的低通时间常数（Q 滤波器），单位：秒
+#define ACCELERATION_TF 0.05f   // 角加速度、线加速度的低通时间常数，单位：秒
+#define STANDSTILL_SPEED 0.005f // 低于该速度（m/s）认为轮子静止，保持外力估计
+#define MIN_COM_HEIGHT 0.02f    // 质心高度下限，单位：米
+
+#define PITCH_OFFSET_LIMIT 10.0f // 平衡角度偏移上限，单位：°
+#define EFFORT_LIMIT 4.0f        // 补偿电压上限，单位：V
+
+DisturbanceObserver::DisturbanceObserver(const float wheel_radius) : wheel_radius_(wheel_radius) {
+}
+
+void DisturbanceObserver::reset() {
+  initialized_ = false;
+  pitch_rate_ = 0;
+  speed_ = 0;
+  pitch_acceleration_ = 0;
+  acceleration_ = 0;
+  torque_ = 0;
+  force_ = 0;
+  pitch_offset_ = 0;
+  effort_ = 0;
+}
+
+void DisturbanceObserver::update(const float dt, const float pitch, const float pitch_rate, const float speed,
+  const float effort, const float com_height) {
+  const float theta = pitch * DEG_TO_RAD;
+  const float omega = pitch_rate * DEG_TO_RAD;
+  if (!initialized_ || dt <= 0) {
+    pitch_rate_ = omega;
+    speed_ = speed;
+    initialized_ = true;
+    return;
+  }
+
+  const float alpha = dt / (ACCELERATION_TF + dt);
+  pitch_acceleration_ += alpha * ((omega - pitch_rate_) / dt - pitch_acceleration_);
+  acceleration_ += alpha * ((speed - speed_) / dt - acceleration_);
+  pitch_rate_ = omega;
+  speed_ = speed;
+
+  // 名义模型（M 轮部，m 车身，L 质心高度，τ 电机力矩）：
+  //   (J + mL²)θ'' + mL·x'' - mgL·sinθ = -τ + 外力矩
+  //   (M + m)x'' + mL·θ'' = τ/r + 外力
+  const float height = fmaxf(com_height, MIN_COM_HEIGHT);
+  const float mass_arm = BODY_MASS * height;
+  const float torque = TORQUE_PER_VOLT * effort;
+  const float raw_torque = (BODY_INERTIA + mass_arm * height) * pitch_acceleration_ + mass_arm * acceleration_
+                           - mass_arm * GRAVITY * sinf(theta) + torque;
+  const float raw_force = (BODY_MASS + WHEEL_MASS) * acceleration_ + mass_arm * pitch_acceleration_ - torque / wheel_radius_;
+
+  const float q = dt / (FILTER_TF + dt);
+  torque_ += q * (raw_torque - torque_);
+  // 静止时轮部外力由静摩擦决定，大小随输出变化，跟着它走只会在静摩擦区内来回试探
+  if (fabsf(speed) > STANDSTILL_SPEED) {
+    force_ += q * (raw_force - force_);
+  }
+
+  // 抵消轮部外力需要的电压；力矩反作用在车身上，与外力矩一起由重力平衡
+  effort_ = constrain(-wheel_radius_ * force_ / TORQUE_PER_VOLT, -EFFORT_LIMIT, EFFORT_LIMIT);
+  const float ratio = constrain((-wheel_radius_ * force_ - torque_) / (mass_arm * GRAVITY), -1.0f, 1.0f);
+  pitch_offset_ = constrain(asinf(ratio) * RAD_TO_DEG, -PITCH_OFFSET_LIMIT, PITCH_OFFSET_LIMIT);
+}
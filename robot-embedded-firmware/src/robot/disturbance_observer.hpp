@@ -0,0 +1,87 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 扰动观测器：估计外力和外力矩并前馈补偿
+ *
+ * 以线性化的两轮倒立摆为名义模型，由俯仰角加速度、轮部线加速度和上一周期的输出电压
+ * 反推模型解释不了的部分：
+ * - 车身外力矩：质心前后偏移、负载、腿部姿态误差等，折算成平衡角度偏移；
+ * - 轮部外力：斜坡、滚动摩擦、推力等，折算成需要补偿的电压，同时也使平衡角度偏移。
+ * 两者都经过低通（Q 滤波器）后输出，静止时保持轮部外力的估计不变，避免在静摩擦区内来回追逐。
+ *
+ * 稳态时加速度为零，估计值只剩静力平衡项，因此补偿量与模型参数（质量、力矩系数）的误差无关，
+ * 参数误差只影响动态过程中的收敛速度。
+ */
+class DisturbanceObserver {
+public:
+  /**
+   * @param wheel_radius 轮子半径（米）
+   */
+  explicit DisturbanceObserver(float wheel_radius);
+
+  /** @brief 清空估计值，补偿量归零 */
+  void reset();
+
+  /**
+   * @brief 更新一个控制周期
+   * @param dt 周期（秒）
+   * @param pitch 相对名义平衡角度（角度零点 + 前馈）的俯仰角（°），向前倒为正
+   * @param pitch_rate 俯仰角速度（°/s）
+   * @param speed 轮部线速度（m/s），前进为正
+   * @param effort 上一周期实际输出的电压（V），正值为向前的力矩
+   * @param com_height 质心到轮轴的高度（米）
+   */
+  void update(float dt, float pitch, float pitch_rate, float speed, float effort, float com_height);
+
+  /** @brief 名义平衡角度之外的平衡角度偏移（°），从俯仰角误差中扣除 */
+  float pitch_offset() const {
+    return pitch_offset_;
+  }
+
+  /** @brief 轮部外力的补偿电压（V），叠加到输出 */
+  float effort() const {
+    return effort_;
+  }
+
+  /** @brief 车身外力矩估计（N·m），向前倒为正 */
+  float torque() const {
+    return torque_;
+  }
+
+  /** @brief 轮部外力估计（N），向前为正 */
+  float force() const {
+    return force_;
+  }
+
+private:
+  float wheel_radius_;
+
+  bool initialized_ = false;
+  float pitch_rate_ = 0;  // rad/s
+  float speed_ = 0;       // m/s
+  float pitch_acceleration_ = 0;
+  float acceleration_ = 0;
+  float torque_ = 0;
+  float force_ = 0;
+  float pitch_offset_ = 0;
+  float effort_ = 0;
+};
@@ -0,0 +1,46 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+
+#include "explicit_mpc.hpp"
+
+ExplicitMpc::ExplicitMpc(const ExplicitMpcTable& table) : table_(table) {
+}
+
+float ExplicitMpc::evaluate(const float state[3]) {
+  float clamped[3];
+  for (int i = 0; i < 3; i++) {
+    clamped[i] = constrain(state[i], -table_.bounds[i], table_.bounds[i]);
+  }
+
+  int16_t index = table_.root;
+  for (uint8_t level = 0; index >= 0 && level < table_.depth; level++) {
+    const ExplicitMpcNode& node = table_.nodes[index];
+    const float side = node.normal[0] * clamped[0] + node.normal[1] * clamped[1] + node.normal[2] * clamped[2];
+    index = side <= node.offset ? node.below : node.above;
+  }
+  if (index >= 0) {
+    // 超过树深仍未到叶子，查找表与生成器不一致
+    law_ = -1;
+    return 0;
+  }
+
+  // 区域按边界内的状态选择，控制律用原始状态计算，超出范围时仍按线性律外推后限幅
+  law_ = static_cast<int16_t>(-1 - index);
+  const ExplicitMpcLaw& law = table_.laws[law_];
+  const float u = law.gain[0] * state[0] + law.gain[1] * state[1] + law.gain[2] * state[2] + law.offset;
+  return constrain(u, -table_.limit, table_.limit);
+}
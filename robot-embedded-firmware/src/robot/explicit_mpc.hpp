@@ -0,0 +1,71 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+
+#pragma once
+
+#include "defs.h"
+
+/** @brief 搜索树节点：normal·x <= offset 时进入 below，否则进入 above；负数表示控制律 -1 - index */
+struct ExplicitMpcNode {
+  float normal[3];
+  float offset;
+  int16_t below;
+  int16_t above;
+};
+
+/** @brief 仿射控制律 u = gain·x + offset */
+struct ExplicitMpcLaw {
+  float gain[3];
+  float offset;
+};
+
+/** @brief 由 tools/jump_mpc.py 离线生成的查找表，常量数组放在 flash 中 */
+struct ExplicitMpcTable {
+  const ExplicitMpcNode* nodes;
+  const ExplicitMpcLaw* laws;
+  float bounds[3]; // 覆盖的状态范围，超出时按边界选择区域
+  float limit;     // 输出上限
+  int16_t root;
+  uint8_t depth;   // 树深，查找最多比较这么多次
+};
+
+/**
+ * @brief 显式模型预测控制
+ *
+ * 带约束的 MPC 的解是状态空间上的分段仿射函数，离线求出后按超平面组织成二叉搜索树。
+ * 每个周期沿树比较至多 depth 次找到所在区域，再做一次仿射运算，不需要在线求解 QP。
+ */
+class ExplicitMpc {
+public:
+  explicit ExplicitMpc(const ExplicitMpcTable& table);
+
+  /**
+   * @brief 计算控制量
+   * @param state 状态，单位与生成查找表时一致
+   * @return 控制量，已限幅
+   */
+  float evaluate(const float state[3]);
+
+  /** @brief 上一次命中的控制律编号，-1 表示查找表损坏 */
+  int16_t law() const {
+    return law_;
+  }
+
+private:
+  const ExplicitMpcTable& table_;
+  int16_t law_ = -1;
+};
@@ -0,0 +1,42 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "heading_estimator.hpp"
+
+#include <cmath>
+
+#define BIAS_TIME_CONSTANT 5.0f // 零偏估计时间常数，单位：秒
+#define SLIP_THRESHOLD 20.0f    // 陀螺仪与轮速差超过该值视为打滑，不用于零偏估计，单位：°/s
+#define BIAS_RATE_MAX 3.0f      // 轮速换算的转速低于该值才估计零偏，单位：°/s
+#define BIAS_LIMIT 5.0f         // 零偏上限，单位：°/s
+
+void HeadingEstimator::reset() {
+  heading_ = 0;
+  rate_ = 0;
+}
+
+void HeadingEstimator::update(const float dt, const float gyro, const float odometry, const bool odometry_valid) {
+  // 只在几乎不转时估计零偏：转弯时轮距误差、轮子侧滑造成的差值和转速成正比，会被当成零偏学进去
+  if (odometry_valid && fabsf(odometry) < BIAS_RATE_MAX) {
+    if (const float difference = gyro - odometry; fabsf(difference - bias_) < SLIP_THRESHOLD) {
+      bias_ += (difference - bias_) * dt / BIAS_TIME_CONSTANT;
+      bias_ = fmaxf(-BIAS_LIMIT, fminf(BIAS_LIMIT, bias_));
+    }
+  }
+
+  rate_ = gyro - bias_;
+  heading_ += rate_ * dt;
+}
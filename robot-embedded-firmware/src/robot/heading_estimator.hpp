@@ -0,0 +1,63 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 航向估计
+ *
+ * 陀螺仪 Z 轴积分得到航向，短时间内精度高但有零偏漂移；
+ * 左右轮差速得到的转速没有漂移，但打滑、离地时不可信。
+ * 轮子可信且几乎不转时用两者之差缓慢估计陀螺仪零偏，航向仍由扣除零偏后的陀螺仪积分得到。
+ */
+class HeadingEstimator {
+public:
+  HeadingEstimator() = default;
+
+  /** @brief 航向归零，保留已学到的零偏 */
+  void reset();
+
+  /**
+   * @brief 更新一个控制周期
+   * @param dt 周期（秒）
+   * @param gyro 陀螺仪 Z 轴角速度（°/s）
+   * @param odometry 左右轮差速换算的转速（°/s）
+   * @param odometry_valid 轮子着地且不在跳跃中
+   */
+  void update(float dt, float gyro, float odometry, bool odometry_valid);
+
+  /** @brief 航向（°），连续累加，不回绕 */
+  float heading() const {
+    return heading_;
+  }
+
+  /** @brief 扣除零偏后的转速（°/s） */
+  float rate() const {
+    return rate_;
+  }
+
+  /** @brief 当前估计的陀螺仪零偏（°/s） */
+  float gyro_bias() const {
+    return bias_;
+  }
+
+private:
+  float heading_ = 0;
+  float rate_ = 0;
+  float bias_ = 0;
+};
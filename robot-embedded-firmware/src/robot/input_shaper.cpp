@@ -0,0 +1,113 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "input_shaper.hpp"
+
+#include <cmath>
+
+InputShaper::InputShaper(const float interval) : interval_(interval) {
+}
+
+void InputShaper::configure(const Type type, const float frequency, const float damping) {
+  if (type == type_ && frequency == frequency_ && damping == damping_) {
+    return;
+  }
+  // 旧的脉冲序列作用在历史上的结果就是当前输出，历史改成这个值后换参数，输出连续
+  const Sample current = shaped();
+  const bool was_settled = settled();
+  for (Sample& sample : history_) {
+    sample = current;
+  }
+  idle_ = was_settled ? HISTORY : 0;
+  type_ = type;
+  frequency_ = frequency;
+  damping_ = damping;
+
+  if (frequency <= 0) {
+    impulses_ = 1;
+    amplitude_[0] = 1;
+    offset_[0] = 0;
+    delay_ = 0;
+    return;
+  }
+
+  const float zeta = constrain(damping, 0.0f, 0.99f);
+  const float root = sqrtf(1 - zeta * zeta);
+  // 半个阻尼周期，超过历史长度时截断（频率太低的振型无法在缓冲区内完整整形）
+  float half_period = 0.5f / (frequency * root) / interval_;
+  const int max_half_period = (HISTORY - 2) / (type == ZVD ? 2 : 1);
+  half_period = fminf(half_period, static_cast<float>(max_half_period));
+  const float K = expf(-zeta * static_cast<float>(M_PI) / root);
+
+  if (type == ZVD) {
+    const float sum = (1 + K) * (1 + K);
+    impulses_ = 3;
+    amplitude_[0] = 1 / sum;
+    amplitude_[1] = 2 * K / sum;
+    amplitude_[2] = K * K / sum;
+  }
+  else {
+    impulses_ = 2;
+    amplitude_[0] = 1 / (1 + K);
+    amplitude_[1] = K / (1 + K);
+  }
+  for (int i = 0; i < impulses_; i++) {
+    offset_[i] = static_cast<float>(i) * half_period;
+  }
+  delay_ = static_cast<int>(ceilf(offset_[impulses_ - 1]));
+}
+
+void InputShaper::reset(const float position) {
+  for (Sample& sample : history_) {
+    sample = { position, 0, 0 };
+  }
+  head_ = 0;
+  idle_ = HISTORY;
+}
+
+InputShaper::Sample InputShaper::at(const int delay) const {
+  return history_[(head_ - delay) & (HISTORY - 1)];
+}
+
+InputShaper::Sample InputShaper::update(const Sample& input) {
+  const Sample& last = history_[head_];
+  if (input.position == last.position && input.velocity == last.velocity && input.acceleration == last.acceleration) {
+    idle_ = idle_ < HISTORY ? idle_ + 1 : HISTORY;
+  }
+  else {
+    idle_ = 0;
+  }
+  head_ = (head_ + 1) & (HISTORY - 1);
+  history_[head_] = input;
+  return shaped();
+}
+
+InputShaper::Sample InputShaper::shaped() const {
+  // 脉冲落在两个采样之间时线性插值
+  Sample output = {};
+  for (int i = 0; i < impulses_; i++) {
+    const int whole = static_cast<int>(offset_[i]);
+    const float fraction = offset_[i] - static_cast<float>(whole);
+    const Sample a = at(whole);
+    const Sample b = at(whole + 1);
+    const float w0 = amplitude_[i] * (1 - fraction);
+    const float w1 = amplitude_[i] * fraction;
+    output.position += w0 * a.position + w1 * b.position;
+    output.velocity += w0 * a.velocity + w1 * b.velocity;
+    output.acceleration += w0 * a.acceleration + w1 * b.acceleration;
+  }
+  return output;
+}
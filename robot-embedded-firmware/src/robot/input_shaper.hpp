@@ -0,0 +1,96 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 输入整形器（ZV / ZVD）
+ *
+ * 把指令与一组脉冲卷积：脉冲的时间间隔为被抑制振型的半个阻尼周期，幅值按阻尼比分配，
+ * 各脉冲激起的振荡互相抵消，指令结束后不留残余振动。ZVD 多一个脉冲，对频率误差更不敏感，
+ * 代价是多延迟半个周期。
+ *
+ * 以固定周期调用 update()，历史采样保存在定长环形缓冲区中，不分配内存。
+ */
+class InputShaper {
+public:
+  enum Type {
+    ZV,  // 两个脉冲，延迟半个阻尼周期
+    ZVD, // 三个脉冲，延迟一个阻尼周期
+  };
+
+  /** @brief 一个采样点：位置及其一、二阶导数，卷积是线性的，三者按同样的脉冲整形 */
+  struct Sample {
+    float position;
+    float velocity;
+    float acceleration;
+  };
+
+  /** @param interval 采样周期（秒） */
+  explicit InputShaper(float interval);
+
+  /**
+   * @brief 设置被抑制的振型
+   *
+   * 运动中也可以调用：参数变化时按旧参数算出当前输出，历史全部改成这个输出，
+   * 新的脉冲序列从当前位置接着整形，输出不会跳变。
+   *
+   * @param type ZV 或 ZVD
+   * @param frequency 无阻尼固有频率（Hz），不大于0时关闭整形
+   * @param damping 阻尼比（0~1）
+   */
+  void configure(Type type, float frequency, float damping);
+
+  /** @brief 历史全部置为静止在 position */
+  void reset(float position);
+
+  /** @brief 压入一个新采样，返回整形后的输出 */
+  Sample update(const Sample& input);
+
+  /** @brief 输入保持不变已超过整形延迟，输出与输入一致 */
+  bool settled() const {
+    return idle_ > delay_;
+  }
+
+  /** @brief 整形带来的总延迟（秒） */
+  float delay() const {
+    return static_cast<float>(delay_) * interval_;
+  }
+
+private:
+  static constexpr int MAX_IMPULSES = 3;
+  static constexpr int HISTORY = 64; // 2 的幂
+
+  Sample at(int delay) const;
+
+  /** @brief 当前历史按脉冲卷积的结果 */
+  Sample shaped() const;
+
+  float interval_;
+  Type type_ = ZV;
+  float frequency_ = 0;
+  float damping_ = 0;
+  int impulses_ = 1;
+  float amplitude_[MAX_IMPULSES] = { 1 };
+  float offset_[MAX_IMPULSES] = { 0 }; // 各脉冲的延迟，单位：采样周期，可以是小数
+  int delay_ = 0;                       // 最后一个脉冲的延迟，向上取整
+
+  Sample history_[HISTORY] = {};
+  int head_ = 0; // 最新采样的位置
+  int idle_ = 0; // 输入连续不变的采样数
+};
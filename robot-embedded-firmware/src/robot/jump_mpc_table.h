@@ -0,0 +1,668 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// 由 tools/jump_mpc.py 生成，请勿手动修改
+
+#pragma once
+
+#include "explicit_mpc.hpp"
+
+// 状态 { 俯仰角(°), 俯仰角速度(°/s), 轮子转速(rad/s) }，输出 LQR_u(V)，预测 6 步
+// 节点 { 法向量, 偏移, a·x <= b 时的子节点, 否则的子节点 }，子节点为负数时是控制律 -1 - index
+
+// 着地：91 个区域，33 条控制律，树深 18
+static const ExplicitMpcNode jump_mpc_stance_nodes[] = {
+  { { 2.233833e-02f, 1.521665e-03f, 5.309557e-03f }, -1.931295e-02f, 1, 170 }, // 0
+  { { 3.320961e-03f, 1.037101e-03f, 1.130529e-02f }, -8.772101e-01f, 2, 72 }, // 1
+  { { 8.594600e-03f, 1.231864e-03f, 1.038871e-02f }, -7.974666e-01f, 3, 36 }, // 2
+  { { 1.057486e-02f, 1.292694e-03f, 9.937194e-03f }, -7.591690e-01f, 4, 20 }, // 3
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, 3.794161e-02f, 5, 19 }, // 4
+  { { 2.098783e-02f, 1.522371e-03f, 6.030415e-03f }, -4.379928e-01f, 6, 10 }, // 5
+  { { 7.656871e-03f, 1.188550e-03f, 1.061552e-02f }, -8.167236e-01f, 7, 8 }, // 6
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -1.998721e-01f, -33, -31 }, // 7
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 9 }, // 8
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -30 }, // 9
+  { { 1.990046e-02f, 1.509885e-03f, 6.600358e-03f }, -4.841811e-01f, 11, 13 }, // 10
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, 12 }, // 11
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -1.998721e-01f, -33, -31 }, // 12
+  { { 1.921261e-03f, 9.638795e-04f, 1.151105e-02f }, -8.955831e-01f, 14, 16 }, // 13
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 15 }, // 14
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, -1.094058e-01f, -33, -21 }, // 15
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 17 }, // 16
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, -1.094058e-01f, -33, 18 }, // 17
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -20 }, // 18
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -8.498418e-02f, -31, -32 }, // 19
+  { { 3.368933e-04f, -8.679712e-04f, -1.172176e-02f }, 9.155272e-01f, 21, 31 }, // 20
+  { { 3.574624e-03f, 1.040920e-03f, 1.128562e-02f }, -8.753324e-01f, 22, 24 }, // 21
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 23 }, // 22
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -20 }, // 23
+  { { 2.210752e-02f, 1.529934e-03f, 5.385457e-03f }, -3.859051e-01f, 25, 28 }, // 24
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 26 }, // 25
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 27 }, // 26
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -29 }, // 27
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 29 }, // 28
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 30 }, // 29
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -19 }, // 30
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, 3.794161e-02f, 32, -32 }, // 31
+  { { 1.921261e-03f, 9.638795e-04f, 1.151105e-02f }, -8.955831e-01f, 33, 34 }, // 32
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -1.998721e-01f, -33, -21 }, // 33
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 35 }, // 34
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -20 }, // 35
+  { { 6.828739e-04f, 9.167005e-04f, 1.162652e-02f }, -9.064735e-01f, 37, 52 }, // 36
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 6.839461e-02f, 38, -32 }, // 37
+  { { 1.005618e-02f, 1.283104e-03f, 1.004341e-02f }, -7.682118e-01f, 39, 42 }, // 38
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 40 }, // 39
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, -1.094058e-01f, -33, 41 }, // 40
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -20 }, // 41
+  { { 1.601655e-04f, -8.696582e-04f, -1.171916e-02f }, 9.151043e-01f, 43, 48 }, // 42
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, -1.495952e-01f, -33, 44 }, // 43
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 45 }, // 44
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, -4.531304e-01f, -33, 46 }, // 45
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -8.229677e-02f, -33, 47 }, // 46
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -12 }, // 47
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, -1.495952e-01f, -33, 49 }, // 48
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 50 }, // 49
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, -4.531304e-01f, -33, 51 }, // 50
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -8.229677e-02f, -33, -13 }, // 51
+  { { 1.192667e-02f, 1.342669e-03f, 9.548701e-03f }, -7.266644e-01f, 53, 63 }, // 52
+  { { 3.574624e-03f, 1.040920e-03f, 1.128562e-02f }, -8.753324e-01f, 54, 56 }, // 53
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 55 }, // 54
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -20 }, // 55
+  { { 2.210752e-02f, 1.529934e-03f, 5.385457e-03f }, -3.859051e-01f, 57, 60 }, // 56
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 58 }, // 57
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 59 }, // 58
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -29 }, // 59
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 61 }, // 60
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 62 }, // 61
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -19 }, // 62
+  { { 2.678661e-02f, 1.456996e-03f, 1.509142e-03f }, 7.495438e-02f, 64, -32 }, // 63
+  { { 1.005618e-02f, 1.283104e-03f, 1.004341e-02f }, -7.682118e-01f, 65, 68 }, // 64
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 66 }, // 65
+  { { 3.574624e-03f, 1.040920e-03f, 1.128562e-02f }, -8.753324e-01f, 67, -33 }, // 66
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -20 }, // 67
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 69 }, // 68
+  { { 3.368933e-04f, -8.679712e-04f, -1.172176e-02f }, 9.155272e-01f, 70, -33 }, // 69
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 71 }, // 70
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -11 }, // 71
+  { { 3.368933e-04f, -8.679712e-04f, -1.172176e-02f }, 9.155272e-01f, 73, 139 }, // 72
+  { { 1.414421e-02f, 1.404581e-03f, 8.876687e-03f }, -6.707490e-01f, 74, 95 }, // 73
+  { { 6.983164e-03f, 1.178662e-03f, 1.070801e-02f }, -8.248712e-01f, 75, 82 }, // 74
+  { { 2.210752e-02f, 1.529934e-03f, 5.385457e-03f }, -3.859051e-01f, 76, 79 }, // 75
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 77 }, // 76
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 78 }, // 77
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -29 }, // 78
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 80 }, // 79
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 81 }, // 80
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -19 }, // 81
+  { { 1.467721e-02f, 1.412956e-03f, 8.720401e-03f }, -6.577617e-01f, 83, 86 }, // 82
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 84 }, // 83
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 85 }, // 84
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -29 }, // 85
+  { { 2.321718e-02f, 1.530969e-03f, 4.674529e-03f }, -3.286904e-01f, 87, 91 }, // 86
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 88 }, // 87
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 89 }, // 88
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, -2.143815e-01f, -33, 90 }, // 89
+  { { 2.626488e-02f, 1.479700e-03f, 2.121991e-03f }, -1.247694e-01f, -33, -28 }, // 90
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 92 }, // 91
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 93 }, // 92
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, -2.143815e-01f, -33, 94 }, // 93
+  { { 2.626488e-02f, 1.479700e-03f, 2.121991e-03f }, -1.247694e-01f, -33, -18 }, // 94
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.438136e-02f, 96, 133 }, // 95
+  { { 2.368179e-03f, 9.945637e-04f, 1.143383e-02f }, -8.887564e-01f, 97, 103 }, // 96
+  { { 6.828739e-04f, 9.167005e-04f, 1.162652e-02f }, -9.064735e-01f, 98, 100 }, // 97
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 99 }, // 98
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -12 }, // 99
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 101 }, // 100
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 102 }, // 101
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -19 }, // 102
+  { { 6.983164e-03f, 1.178662e-03f, 1.070801e-02f }, -8.248712e-01f, 104, 107 }, // 103
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 105 }, // 104
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 106 }, // 105
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, -1.503682e-01f, -33, -19 }, // 106
+  { { 1.969312e-02f, 1.511118e-03f, 6.680273e-03f }, -4.907046e-01f, 108, 112 }, // 107
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 109 }, // 108
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 110 }, // 109
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, -2.143815e-01f, -33, 111 }, // 110
+  { { 2.626488e-02f, 1.479700e-03f, 2.121991e-03f }, -1.247694e-01f, -33, -28 }, // 111
+  { { 2.421614e-02f, 1.524884e-03f, 3.956345e-03f }, -2.710880e-01f, 113, 118 }, // 112
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, -2.854724e-01f, -33, 114 }, // 113
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 115 }, // 114
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, -2.143815e-01f, -33, 116 }, // 115
+  { { 2.567877e-02f, 1.497978e-03f, 2.724612e-03f }, -1.727079e-01f, -33, 117 }, // 116
+  { { 2.654704e-02f, 1.468396e-03f, 1.800139e-03f }, -9.921400e-02f, -33, -27 }, // 117
+  { { 5.314393e-04f, -8.553082e-04f, -1.174400e-02f }, 9.176004e-01f, 119, 130 }, // 118
+  { { 1.061767e-03f, -8.205048e-04f, -1.180088e-02f }, 9.229603e-01f, 120, 127 }, // 119
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -1.998721e-01f, -33, 121 }, // 120
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, -2.143815e-01f, -33, 122 }, // 121
+  { { 2.567877e-02f, 1.497978e-03f, 2.724612e-03f }, -1.727079e-01f, -33, 123 }, // 122
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 124 }, // 123
+  { { 2.679213e-02f, 1.456725e-03f, 1.501881e-03f }, -7.555969e-02f, -33, 125 }, // 124
+  { { 2.624200e-02f, 1.480721e-03f, 2.143885e-03f }, -1.265110e-01f, -33, 126 }, // 125
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.668168e-02f, -33, -1 }, // 126
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -1.998721e-01f, -33, 128 }, // 127
+  { { 2.679213e-02f, 1.456725e-03f, 1.501881e-03f }, -7.555969e-02f, -33, 129 }, // 128
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.668168e-02f, -33, -3 }, // 129
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, -1.998721e-01f, -33, 131 }, // 130
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.668168e-02f, -33, 132 }, // 131
+  { { 8.650308e-04f, -8.334644e-04f, -1.178042e-02f }, 9.210217e-01f, -33, -7 }, // 132
+  { { 1.061767e-03f, -8.205048e-04f, -1.180088e-02f }, 9.229603e-01f, 134, 137 }, // 133
+  { { 2.567877e-02f, 1.497978e-03f, 2.724612e-03f }, 1.727079e-01f, 135, -32 }, // 134
+  { { 2.679213e-02f, 1.456725e-03f, 1.501881e-03f }, 7.555969e-02f, 136, -32 }, // 135
+  { { 2.654704e-02f, 1.468396e-03f, 1.800139e-03f }, 9.921400e-02f, -1, -32 }, // 136
+  { { 2.623622e-02f, 1.480917e-03f, 2.150459e-03f }, 1.259366e-01f, 138, -32 }, // 137
+  { { 2.679088e-02f, 1.456785e-03f, 1.503543e-03f }, 7.542186e-02f, -3, -32 }, // 138
+  { { 2.678661e-02f, 1.456996e-03f, 1.509142e-03f }, 7.495438e-02f, 140, 167 }, // 139
+  { { 2.368179e-03f, 9.945637e-04f, 1.143383e-02f }, -8.887564e-01f, 141, 151 }, // 140
+  { { 1.601655e-04f, -8.696582e-04f, -1.171916e-02f }, 9.151043e-01f, 142, 147 }, // 141
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, -1.495952e-01f, -33, 143 }, // 142
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 144 }, // 143
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, -4.531304e-01f, -33, 145 }, // 144
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -8.229677e-02f, -33, 146 }, // 145
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, -1.754803e-01f, -33, -12 }, // 146
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, -1.495952e-01f, -33, 148 }, // 147
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, -2.168536e-01f, -33, 149 }, // 148
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, -4.531304e-01f, -33, 150 }, // 149
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -8.229677e-02f, -33, -13 }, // 150
+  { { 1.703741e-03f, 9.624867e-04f, 1.151878e-02f }, -8.964586e-01f, 152, 155 }, // 151
+  { { 2.484283e-02f, 1.513708e-03f, 3.489725e-03f }, -2.337339e-01f, -33, 153 }, // 152
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -8.229677e-02f, -33, 154 }, // 153
+  { { 1.601655e-04f, -8.696582e-04f, -1.171916e-02f }, 9.151043e-01f, -33, -13 }, // 154
+  { { 8.650308e-04f, -8.334644e-04f, -1.178042e-02f }, 9.210217e-01f, 156, 162 }, // 155
+  { { 2.619588e-02f, 1.482280e-03f, 2.195643e-03f }, -1.306233e-01f, -33, 157 }, // 156
+  { { 2.484283e-02f, 1.513708e-03f, 3.489725e-03f }, -2.337339e-01f, -33, 158 }, // 157
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, -1.495952e-01f, -33, 159 }, // 158
+  { { 1.042639e-02f, 1.283110e-03f, 9.990166e-03f }, -7.635746e-01f, -33, 160 }, // 159
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, -2.518500e-01f, -33, 161 }, // 160
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.668168e-02f, -33, -6 }, // 161
+  { { 2.619588e-02f, 1.482280e-03f, 2.195643e-03f }, -1.306233e-01f, -33, 163 }, // 162
+  { { 2.484283e-02f, 1.513708e-03f, 3.489725e-03f }, -2.337339e-01f, -33, 164 }, // 163
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, -1.495952e-01f, -33, 165 }, // 164
+  { { 1.042639e-02f, 1.283110e-03f, 9.990166e-03f }, -7.635746e-01f, -33, 166 }, // 165
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.668168e-02f, -33, -7 }, // 166
+  { { 1.703741e-03f, 9.624867e-04f, 1.151878e-02f }, -8.964586e-01f, 168, 169 }, // 167
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 6.839461e-02f, -13, -32 }, // 168
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.438136e-02f, -7, -32 }, // 169
+  { { 3.320961e-03f, 1.037101e-03f, 1.130529e-02f }, 8.772101e-01f, 171, 270 }, // 170
+  { { 3.368933e-04f, -8.679712e-04f, -1.172176e-02f }, -9.155272e-01f, 172, 203 }, // 171
+  { { 2.678661e-02f, 1.456996e-03f, 1.509142e-03f }, -7.495438e-02f, 173, 176 }, // 172
+  { { 1.703741e-03f, 9.624867e-04f, 1.151878e-02f }, 8.964586e-01f, 174, 175 }, // 173
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.438136e-02f, -33, -5 }, // 174
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -6.839461e-02f, -33, -10 }, // 175
+  { { 2.368179e-03f, 9.945637e-04f, 1.143383e-02f }, 8.887564e-01f, 177, 193 }, // 176
+  { { 1.703741e-03f, 9.624867e-04f, 1.151878e-02f }, 8.964586e-01f, 178, 190 }, // 177
+  { { 8.650308e-04f, -8.334644e-04f, -1.178042e-02f }, -9.210217e-01f, 179, 184 }, // 178
+  { { 2.619588e-02f, 1.482280e-03f, 2.195643e-03f }, 1.306233e-01f, 180, -32 }, // 179
+  { { 2.484283e-02f, 1.513708e-03f, 3.489725e-03f }, 2.337339e-01f, 181, -32 }, // 180
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, 1.495952e-01f, 182, -32 }, // 181
+  { { 1.042639e-02f, 1.283110e-03f, 9.990166e-03f }, 7.635746e-01f, 183, -32 }, // 182
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.668168e-02f, -5, -32 }, // 183
+  { { 2.619588e-02f, 1.482280e-03f, 2.195643e-03f }, 1.306233e-01f, 185, -32 }, // 184
+  { { 2.484283e-02f, 1.513708e-03f, 3.489725e-03f }, 2.337339e-01f, 186, -32 }, // 185
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, 1.495952e-01f, 187, -32 }, // 186
+  { { 1.042639e-02f, 1.283110e-03f, 9.990166e-03f }, 7.635746e-01f, 188, -32 }, // 187
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 189, -32 }, // 188
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.668168e-02f, -4, -32 }, // 189
+  { { 2.484283e-02f, 1.513708e-03f, 3.489725e-03f }, 2.337339e-01f, 191, -32 }, // 190
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 8.229677e-02f, 192, -32 }, // 191
+  { { 1.601655e-04f, -8.696582e-04f, -1.171916e-02f }, -9.151043e-01f, -10, -32 }, // 192
+  { { 1.601655e-04f, -8.696582e-04f, -1.171916e-02f }, -9.151043e-01f, 194, 198 }, // 193
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, 1.495952e-01f, 195, -32 }, // 194
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 196, -32 }, // 195
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, 4.531304e-01f, 197, -32 }, // 196
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 8.229677e-02f, -10, -32 }, // 197
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, 1.495952e-01f, 199, -32 }, // 198
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 200, -32 }, // 199
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, 4.531304e-01f, 201, -32 }, // 200
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 8.229677e-02f, 202, -32 }, // 201
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -9, -32 }, // 202
+  { { 1.414421e-02f, 1.404581e-03f, 8.876687e-03f }, 6.707490e-01f, 204, 249 }, // 203
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, -7.438136e-02f, 205, 212 }, // 204
+  { { 1.061767e-03f, -8.205048e-04f, -1.180088e-02f }, -9.229603e-01f, 206, 208 }, // 205
+  { { 2.623622e-02f, 1.480917e-03f, 2.150459e-03f }, -1.259366e-01f, -33, 207 }, // 206
+  { { 2.679088e-02f, 1.456785e-03f, 1.503543e-03f }, -7.542186e-02f, -33, -2 }, // 207
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, -2.143815e-01f, -33, 209 }, // 208
+  { { 2.567877e-02f, 1.497978e-03f, 2.724612e-03f }, -1.727079e-01f, -33, 210 }, // 209
+  { { 2.679213e-02f, 1.456725e-03f, 1.501881e-03f }, -7.555969e-02f, -33, 211 }, // 210
+  { { 2.654704e-02f, 1.468396e-03f, 1.800139e-03f }, -9.921400e-02f, -33, -1 }, // 211
+  { { 2.368179e-03f, 9.945637e-04f, 1.143383e-02f }, 8.887564e-01f, 213, 243 }, // 212
+  { { 6.983164e-03f, 1.178662e-03f, 1.070801e-02f }, 8.248712e-01f, 214, 240 }, // 213
+  { { 1.969312e-02f, 1.511118e-03f, 6.680273e-03f }, 4.907046e-01f, 215, 236 }, // 214
+  { { 2.421614e-02f, 1.524884e-03f, 3.956345e-03f }, 2.710880e-01f, 216, 231 }, // 215
+  { { 5.314393e-04f, -8.553082e-04f, -1.174400e-02f }, -9.176004e-01f, 217, 220 }, // 216
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 1.998721e-01f, 218, -32 }, // 217
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.668168e-02f, 219, -32 }, // 218
+  { { 8.650308e-04f, -8.334644e-04f, -1.178042e-02f }, -9.210217e-01f, -5, -32 }, // 219
+  { { 1.061767e-03f, -8.205048e-04f, -1.180088e-02f }, -9.229603e-01f, 221, 224 }, // 220
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 1.998721e-01f, 222, -32 }, // 221
+  { { 2.679213e-02f, 1.456725e-03f, 1.501881e-03f }, 7.555969e-02f, 223, -32 }, // 222
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.668168e-02f, -2, -32 }, // 223
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 1.998721e-01f, 225, -32 }, // 224
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, 2.143815e-01f, 226, -32 }, // 225
+  { { 2.567877e-02f, 1.497978e-03f, 2.724612e-03f }, 1.727079e-01f, 227, -32 }, // 226
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 228, -32 }, // 227
+  { { 2.679213e-02f, 1.456725e-03f, 1.501881e-03f }, 7.555969e-02f, 229, -32 }, // 228
+  { { 2.624200e-02f, 1.480721e-03f, 2.143885e-03f }, 1.265110e-01f, 230, -32 }, // 229
+  { { 2.678140e-02f, 1.457248e-03f, 1.516040e-03f }, 7.668168e-02f, -1, -32 }, // 230
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 232, -32 }, // 231
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 233, -32 }, // 232
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, 2.143815e-01f, 234, -32 }, // 233
+  { { 2.567877e-02f, 1.497978e-03f, 2.724612e-03f }, 1.727079e-01f, 235, -32 }, // 234
+  { { 2.654704e-02f, 1.468396e-03f, 1.800139e-03f }, 9.921400e-02f, -22, -32 }, // 235
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 237, -32 }, // 236
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 238, -32 }, // 237
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, 2.143815e-01f, 239, -32 }, // 238
+  { { 2.626488e-02f, 1.479700e-03f, 2.121991e-03f }, 1.247694e-01f, -23, -32 }, // 239
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 241, -32 }, // 240
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 242, -32 }, // 241
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -15, -32 }, // 242
+  { { 6.828739e-04f, 9.167005e-04f, 1.162652e-02f }, 9.064735e-01f, 244, 247 }, // 243
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 245, -32 }, // 244
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 246, -32 }, // 245
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -15, -32 }, // 246
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 248, -32 }, // 247
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -9, -32 }, // 248
+  { { 6.983164e-03f, 1.178662e-03f, 1.070801e-02f }, 8.248712e-01f, 250, 263 }, // 249
+  { { 1.467721e-02f, 1.412956e-03f, 8.720401e-03f }, 6.577617e-01f, 251, 260 }, // 250
+  { { 2.321718e-02f, 1.530969e-03f, 4.674529e-03f }, 3.286904e-01f, 252, 256 }, // 251
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 253, -32 }, // 252
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 254, -32 }, // 253
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, 2.143815e-01f, 255, -32 }, // 254
+  { { 2.626488e-02f, 1.479700e-03f, 2.121991e-03f }, 1.247694e-01f, -14, -32 }, // 255
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 257, -32 }, // 256
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 258, -32 }, // 257
+  { { 2.511734e-02f, 1.509797e-03f, 3.247337e-03f }, 2.143815e-01f, 259, -32 }, // 258
+  { { 2.626488e-02f, 1.479700e-03f, 2.121991e-03f }, 1.247694e-01f, -23, -32 }, // 259
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 261, -32 }, // 260
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 262, -32 }, // 261
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -24, -32 }, // 262
+  { { 2.210752e-02f, 1.529934e-03f, 5.385457e-03f }, 3.859051e-01f, 264, 267 }, // 263
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 265, -32 }, // 264
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 266, -32 }, // 265
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -15, -32 }, // 266
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 268, -32 }, // 267
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 269, -32 }, // 268
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -24, -32 }, // 269
+  { { 8.594600e-03f, 1.231864e-03f, 1.038871e-02f }, 7.974666e-01f, 271, 307 }, // 270
+  { { 6.828739e-04f, 9.167005e-04f, 1.162652e-02f }, 9.064735e-01f, 272, 292 }, // 271
+  { { 1.192667e-02f, 1.342669e-03f, 9.548701e-03f }, 7.266644e-01f, 273, 282 }, // 272
+  { { 2.678661e-02f, 1.456996e-03f, 1.509142e-03f }, -7.495438e-02f, -33, 274 }, // 273
+  { { 1.005618e-02f, 1.283104e-03f, 1.004341e-02f }, 7.682118e-01f, 275, 279 }, // 274
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 276, -32 }, // 275
+  { { 3.368933e-04f, -8.679712e-04f, -1.172176e-02f }, -9.155272e-01f, -32, 277 }, // 276
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 278, -32 }, // 277
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -8, -32 }, // 278
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 280, -32 }, // 279
+  { { 3.574624e-03f, 1.040920e-03f, 1.128562e-02f }, 8.753324e-01f, -32, 281 }, // 280
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -16, -32 }, // 281
+  { { 3.574624e-03f, 1.040920e-03f, 1.128562e-02f }, 8.753324e-01f, 283, 290 }, // 282
+  { { 2.210752e-02f, 1.529934e-03f, 5.385457e-03f }, 3.859051e-01f, 284, 287 }, // 283
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 285, -32 }, // 284
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 286, -32 }, // 285
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -15, -32 }, // 286
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 288, -32 }, // 287
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 289, -32 }, // 288
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -24, -32 }, // 289
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 291, -32 }, // 290
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -16, -32 }, // 291
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, -6.839461e-02f, -33, 293 }, // 292
+  { { 1.005618e-02f, 1.283104e-03f, 1.004341e-02f }, 7.682118e-01f, 294, 304 }, // 293
+  { { 1.601655e-04f, -8.696582e-04f, -1.171916e-02f }, -9.151043e-01f, 295, 299 }, // 294
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, 1.495952e-01f, 296, -32 }, // 295
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 297, -32 }, // 296
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, 4.531304e-01f, 298, -32 }, // 297
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 8.229677e-02f, -10, -32 }, // 298
+  { { 2.597425e-02f, 1.489295e-03f, 2.434278e-03f }, 1.495952e-01f, 300, -32 }, // 299
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 301, -32 }, // 300
+  { { 2.068912e-02f, 1.515188e-03f, 6.217880e-03f }, 4.531304e-01f, 302, -32 }, // 301
+  { { 2.672654e-02f, 1.459894e-03f, 1.586884e-03f }, 8.229677e-02f, 303, -32 }, // 302
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -9, -32 }, // 303
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 305, -32 }, // 304
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, 1.094058e-01f, 306, -32 }, // 305
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -16, -32 }, // 306
+  { { 1.057486e-02f, 1.292694e-03f, 9.937194e-03f }, 7.591690e-01f, 308, 324 }, // 307
+  { { 3.368933e-04f, -8.679712e-04f, -1.172176e-02f }, -9.155272e-01f, 309, 314 }, // 308
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, -3.794161e-02f, -33, 310 }, // 309
+  { { 1.921261e-03f, 9.638795e-04f, 1.151105e-02f }, 8.955831e-01f, 311, 313 }, // 310
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 312, -32 }, // 311
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -16, -32 }, // 312
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 1.998721e-01f, -17, -32 }, // 313
+  { { 3.574624e-03f, 1.040920e-03f, 1.128562e-02f }, 8.753324e-01f, 315, 322 }, // 314
+  { { 2.210752e-02f, 1.529934e-03f, 5.385457e-03f }, 3.859051e-01f, 316, 319 }, // 315
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 317, -32 }, // 316
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 318, -32 }, // 317
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -15, -32 }, // 318
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 320, -32 }, // 319
+  { { 2.456854e-02f, 1.517308e-03f, 3.716362e-03f }, 2.518500e-01f, 321, -32 }, // 320
+  { { 2.596384e-02f, 1.489679e-03f, 2.443993e-03f }, 1.503682e-01f, -24, -32 }, // 321
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 323, -32 }, // 322
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -16, -32 }, // 323
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, -3.794161e-02f, 325, 326 }, // 324
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 8.498418e-02f, -33, -26 }, // 325
+  { { 2.098783e-02f, 1.522371e-03f, 6.030415e-03f }, 4.379928e-01f, 327, 336 }, // 326
+  { { 1.990046e-02f, 1.509885e-03f, 6.600358e-03f }, 4.841811e-01f, 328, 334 }, // 327
+  { { 1.921261e-03f, 9.638795e-04f, 1.151105e-02f }, 8.955831e-01f, 329, 332 }, // 328
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 330, -32 }, // 329
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, 1.094058e-01f, 331, -32 }, // 330
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -16, -32 }, // 331
+  { { 2.508876e-02f, 1.509789e-03f, 3.278354e-03f }, 2.168536e-01f, 333, -32 }, // 332
+  { { 2.644529e-02f, 1.472194e-03f, 1.928612e-03f }, 1.094058e-01f, -17, -32 }, // 333
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, 335, -32 }, // 334
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 1.998721e-01f, -26, -32 }, // 335
+  { { 7.656871e-03f, 1.188550e-03f, 1.061552e-02f }, 8.167236e-01f, 337, 339 }, // 336
+  { { 2.403980e-02f, 1.521459e-03f, 4.136449e-03f }, 2.854724e-01f, 338, -32 }, // 337
+  { { 2.565039e-02f, 1.498160e-03f, 2.759481e-03f }, 1.754803e-01f, -25, -32 }, // 338
+  { { 2.532848e-02f, 1.505152e-03f, 3.065539e-03f }, 1.998721e-01f, -26, -32 }, // 339
+};
+
+static const ExplicitMpcLaw jump_mpc_stance_laws[] = {
+  { { 2.127494e+00f, 1.156747e-01f, 1.192605e-01f }, 0.000000e+00f }, // 0
+  { { 2.127482e+00f, 1.156843e-01f, 1.193973e-01f }, -1.070032e-02f }, // 1
+  { { 2.127482e+00f, 1.156843e-01f, 1.193973e-01f }, 1.070032e-02f }, // 2
+  { { 2.127477e+00f, 1.157192e-01f, 1.198608e-01f }, -4.688708e-02f }, // 3
+  { { 2.127435e+00f, 1.157594e-01f, 1.204297e-01f }, -9.136528e-02f }, // 4
+  { { 2.127477e+00f, 1.157192e-01f, 1.198608e-01f }, 4.688708e-02f }, // 5
+  { { 2.127435e+00f, 1.157594e-01f, 1.204297e-01f }, 9.136528e-02f }, // 6
+  { { 2.128206e+00f, 1.158970e-01f, 1.216838e-01f }, -1.880286e-01f }, // 7
+  { { 2.128345e+00f, 1.160838e-01f, 1.240528e-01f }, -3.727282e-01f }, // 8
+  { { 2.128313e+00f, 1.162557e-01f, 1.263682e-01f }, -5.535351e-01f }, // 9
+  { { 2.128206e+00f, 1.158970e-01f, 1.216838e-01f }, 1.880286e-01f }, // 10
+  { { 2.128345e+00f, 1.160838e-01f, 1.240528e-01f }, 3.727282e-01f }, // 11
+  { { 2.128313e+00f, 1.162557e-01f, 1.263682e-01f }, 5.535351e-01f }, // 12
+  { { 2.143016e+00f, 1.172162e-01f, 1.290020e-01f }, -7.360948e-01f }, // 13
+  { { 2.149210e+00f, 1.182617e-01f, 1.385005e-01f }, -1.467799e+00f }, // 14
+  { { 2.152172e+00f, 1.191240e-01f, 1.478493e-01f }, -2.192901e+00f }, // 15
+  { { 2.153710e+00f, 1.198958e-01f, 1.570666e-01f }, -2.910027e+00f }, // 16
+  { { 2.143016e+00f, 1.172162e-01f, 1.290020e-01f }, 7.360948e-01f }, // 17
+  { { 2.149210e+00f, 1.182617e-01f, 1.385005e-01f }, 1.467799e+00f }, // 18
+  { { 2.152172e+00f, 1.191240e-01f, 1.478493e-01f }, 2.192901e+00f }, // 19
+  { { 2.153710e+00f, 1.198958e-01f, 1.570666e-01f }, 2.910027e+00f }, // 20
+  { { 2.389128e+00f, 1.321498e-01f, 1.620053e-01f }, -2.928863e+00f }, // 21
+  { { 2.509150e+00f, 1.413595e-01f, 2.027191e-01f }, -5.919528e+00f }, // 22
+  { { 2.576086e+00f, 1.478033e-01f, 2.424886e-01f }, -8.919258e+00f }, // 23
+  { { 2.617724e+00f, 1.528932e-01f, 2.816159e-01f }, -1.190846e+01f }, // 24
+  { { 2.645550e+00f, 1.572126e-01f, 3.201945e-01f }, -1.487657e+01f }, // 25
+  { { 2.389128e+00f, 1.321498e-01f, 1.620053e-01f }, 2.928863e+00f }, // 26
+  { { 2.509150e+00f, 1.413595e-01f, 2.027191e-01f }, 5.919528e+00f }, // 27
+  { { 2.576086e+00f, 1.478033e-01f, 2.424886e-01f }, 8.919258e+00f }, // 28
+  { { 2.617724e+00f, 1.528932e-01f, 2.816159e-01f }, 1.190846e+01f }, // 29
+  { { 2.645550e+00f, 1.572126e-01f, 3.201945e-01f }, 1.487657e+01f }, // 30
+  { { 0.000000e+00f, 0.000000e+00f, 0.000000e+00f }, 6.000000e+00f }, // 31
+  { { 0.000000e+00f, 0.000000e+00f, 0.000000e+00f }, -6.000000e+00f }, // 32
+};
+
+static const ExplicitMpcTable jump_mpc_stance = {
+  jump_mpc_stance_nodes, jump_mpc_stance_laws, { 30.0f, 400.0f, 80.0f }, 6.0f, 0, 18
+};
+
+// 腾空：91 个区域，33 条控制律，树深 17
+static const ExplicitMpcNode jump_mpc_flight_nodes[] = {
+  { { 2.271908e-02f, 1.817108e-03f, 1.057599e-03f }, -1.004262e-02f, 1, 108 }, // 0
+  { { 2.115807e-02f, 1.915694e-03f, 1.245058e-03f }, -9.337936e-02f, 2, 44 }, // 1
+  { { 2.344044e-02f, 1.765936e-03f, 1.009842e-03f }, -7.573814e-02f, 3, 26 }, // 2
+  { { 1.941917e-02f, 2.012897e-03f, 1.387748e-03f }, -1.040811e-01f, 4, 10 }, // 3
+  { { 2.625288e-02f, 1.535431e-03f, 6.249732e-04f }, 7.107096e-03f, 5, 9 }, // 4
+  { { 2.464085e-02f, 1.674908e-03f, 8.564774e-04f }, -6.423580e-02f, 6, 7 }, // 5
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -31 }, // 6
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, -5.748131e-02f, -33, 8 }, // 7
+  { { 2.625288e-02f, 1.535431e-03f, 6.249732e-04f }, -4.687299e-02f, -33, -21 }, // 8
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -1.379311e-02f, -31, -32 }, // 9
+  { { 2.084636e-02f, 1.934131e-03f, 1.271605e-03f }, -9.537037e-02f, 11, 17 }, // 10
+  { { 2.080189e-02f, 1.937095e-03f, 1.261157e-03f }, -9.458675e-02f, 12, 13 }, // 11
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -31 }, // 12
+  { { 2.501919e-02f, 1.643972e-03f, 8.113526e-04f }, -6.085145e-02f, 14, 16 }, // 13
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, -7.614940e-02f, -33, 15 }, // 14
+  { { 2.614366e-02f, 1.545522e-03f, 6.466385e-04f }, -4.849789e-02f, -33, -30 }, // 15
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -20 }, // 16
+  { { 2.538773e-02f, 1.612787e-03f, 7.648369e-04f }, -5.736277e-02f, 18, 24 }, // 17
+  { { 2.201922e-02f, 1.862679e-03f, 1.152904e-03f }, -8.646781e-02f, 19, 21 }, // 18
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, -7.614940e-02f, -33, 20 }, // 19
+  { { 2.614366e-02f, 1.545522e-03f, 6.466385e-04f }, -4.849789e-02f, -33, -30 }, // 20
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, -7.614940e-02f, -33, 22 }, // 21
+  { { 2.393970e-02f, 1.729579e-03f, 9.329779e-04f }, -6.997334e-02f, -33, 23 }, // 22
+  { { 2.648353e-02f, 1.513415e-03f, 5.984449e-04f }, -4.488337e-02f, -33, -29 }, // 23
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 25 }, // 24
+  { { 2.501919e-02f, 1.643972e-03f, 8.113526e-04f }, -6.085145e-02f, -30, -19 }, // 25
+  { { 1.844806e-02f, 2.061420e-03f, 1.467869e-03f }, -1.100901e-01f, 27, 36 }, // 26
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, 2.110624e-02f, 28, 35 }, // 27
+  { { 2.302174e-02f, 1.795655e-03f, 1.053204e-03f }, -7.899028e-02f, 29, 31 }, // 28
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, -5.748131e-02f, -33, 30 }, // 29
+  { { 2.625288e-02f, 1.535431e-03f, 6.249732e-04f }, -4.687299e-02f, -33, -21 }, // 30
+  { { 2.568781e-02f, 1.586812e-03f, 7.123424e-04f }, -5.342568e-02f, -33, 32 }, // 31
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, -5.748131e-02f, -33, 33 }, // 32
+  { { 2.418980e-02f, 1.710423e-03f, 9.083385e-04f }, -6.812539e-02f, -33, 34 }, // 33
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, -4.155059e-02f, -33, -13 }, // 34
+  { { 2.625288e-02f, 1.535431e-03f, 6.249732e-04f }, 7.107096e-03f, -21, -32 }, // 35
+  { { 2.004570e-02f, 1.979218e-03f, 1.345386e-03f }, -1.009039e-01f, 37, 39 }, // 36
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, -5.748131e-02f, -33, 38 }, // 37
+  { { 2.302174e-02f, 1.795655e-03f, 1.053204e-03f }, -7.899028e-02f, -21, -12 }, // 38
+  { { 2.383536e-02f, 1.736933e-03f, 9.665013e-04f }, -7.248760e-02f, 40, 42 }, // 39
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, -7.614940e-02f, -33, 41 }, // 40
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, -5.112072e-02f, -33, -19 }, // 41
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, -7.614940e-02f, -33, 43 }, // 42
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, -5.112072e-02f, -33, -11 }, // 43
+  { { 2.414673e-02f, 1.713372e-03f, 9.302888e-04f }, -6.977166e-02f, 45, 60 }, // 44
+  { { 2.572884e-02f, 1.582944e-03f, 7.191669e-04f }, -5.393752e-02f, 46, 53 }, // 45
+  { { 2.329963e-02f, 1.776078e-03f, 1.023348e-03f }, -7.675110e-02f, 47, 50 }, // 46
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, -7.614940e-02f, -33, 48 }, // 47
+  { { 2.393970e-02f, 1.729579e-03f, 9.329779e-04f }, -6.997334e-02f, -33, 49 }, // 48
+  { { 2.648353e-02f, 1.513415e-03f, 5.984449e-04f }, -4.488337e-02f, -33, -29 }, // 49
+  { { 2.476203e-02f, 1.665180e-03f, 8.390766e-04f }, -6.293074e-02f, -33, 51 }, // 50
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, -6.717986e-02f, -33, 52 }, // 51
+  { { 2.680921e-02f, 1.481569e-03f, 5.494182e-04f }, -4.120637e-02f, -33, -28 }, // 52
+  { { 2.241967e-02f, 1.836354e-03f, 1.123016e-03f }, -8.422622e-02f, 54, 56 }, // 53
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 55 }, // 54
+  { { 2.538773e-02f, 1.612787e-03f, 7.648369e-04f }, -5.736277e-02f, -29, -19 }, // 55
+  { { 2.329963e-02f, 1.776078e-03f, 1.023348e-03f }, -7.675110e-02f, 57, 58 }, // 56
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -29 }, // 57
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, -6.717986e-02f, -33, 59 }, // 58
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, -5.112072e-02f, -33, -18 }, // 59
+  { { 1.732341e-02f, 2.113242e-03f, 1.550325e-03f }, -1.162744e-01f, 61, 75 }, // 60
+  { { 2.723708e-02f, 1.438031e-03f, 4.772941e-04f }, 3.291634e-02f, 62, 73 }, // 61
+  { { 1.923362e-02f, 2.022228e-03f, 1.411800e-03f }, -1.058850e-01f, 63, 68 }, // 62
+  { { 2.608049e-02f, 1.551305e-03f, 6.590553e-04f }, -4.942915e-02f, -33, 64 }, // 63
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, -6.250930e-02f, -33, 65 }, // 64
+  { { 2.568781e-02f, 1.586812e-03f, 7.123424e-04f }, -5.342568e-02f, -33, 66 }, // 65
+  { { 2.266187e-02f, 1.820591e-03f, 1.080191e-03f }, -8.101433e-02f, -33, 67 }, // 66
+  { { 2.705036e-02f, 1.457345e-03f, 5.051658e-04f }, -3.788743e-02f, -33, -7 }, // 67
+  { { 2.633337e-02f, 1.527660e-03f, 6.248603e-04f }, -4.686452e-02f, -33, 69 }, // 68
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, -6.250930e-02f, -33, 70 }, // 69
+  { { 2.608049e-02f, 1.551305e-03f, 6.590553e-04f }, -4.942915e-02f, -33, 71 }, // 70
+  { { 2.087954e-02f, 1.932623e-03f, 1.252216e-03f }, -9.391617e-02f, -33, 72 }, // 71
+  { { 2.723708e-02f, 1.438031e-03f, 4.772941e-04f }, -3.579706e-02f, -33, -3 }, // 72
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 74 }, // 73
+  { { 2.705036e-02f, 1.457345e-03f, 5.051658e-04f }, 2.894885e-02f, -7, -32 }, // 74
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, -5.112072e-02f, 76, 84 }, // 75
+  { { 2.463261e-02f, 1.675359e-03f, 8.677405e-04f }, -6.508054e-02f, 77, 80 }, // 76
+  { { 2.476203e-02f, 1.665180e-03f, 8.390766e-04f }, -6.293074e-02f, -33, 78 }, // 77
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, -6.717986e-02f, -33, 79 }, // 78
+  { { 2.680921e-02f, 1.481569e-03f, 5.494182e-04f }, -4.120637e-02f, -33, -28 }, // 79
+  { { 2.560588e-02f, 1.593897e-03f, 7.314019e-04f }, -5.485514e-02f, -33, 81 }, // 80
+  { { 2.051669e-02f, 1.953922e-03f, 1.269151e-03f }, -9.518635e-02f, -33, 82 }, // 81
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, -6.717986e-02f, -33, 83 }, // 82
+  { { 2.710568e-02f, 1.451597e-03f, 5.019283e-04f }, -3.764462e-02f, -33, -27 }, // 83
+  { { 2.705036e-02f, 1.457345e-03f, 5.051658e-04f }, 2.894885e-02f, 85, 105 }, // 84
+  { { 2.383536e-02f, 1.736933e-03f, 9.665013e-04f }, -7.248760e-02f, 86, 88 }, // 85
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 87 }, // 86
+  { { 2.572884e-02f, 1.582944e-03f, 7.191669e-04f }, -5.393752e-02f, -28, -19 }, // 87
+  { { 2.463261e-02f, 1.675359e-03f, 8.677405e-04f }, -6.508054e-02f, 89, 90 }, // 88
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -28 }, // 89
+  { { 2.192218e-02f, 1.868553e-03f, 1.175126e-03f }, -8.813443e-02f, 91, 93 }, // 90
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 92 }, // 91
+  { { 2.004570e-02f, 1.979218e-03f, 1.345386e-03f }, -1.009039e-01f, -12, -11 }, // 92
+  { { 2.158303e-02f, 1.889823e-03f, 1.207168e-03f }, -9.053758e-02f, 94, 95 }, // 93
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -12 }, // 94
+  { { 1.957023e-02f, 2.004700e-03f, 1.385967e-03f }, -1.039475e-01f, 96, 98 }, // 95
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 97 }, // 96
+  { { 1.774845e-02f, 2.094180e-03f, 1.520638e-03f }, -1.140478e-01f, -7, -6 }, // 97
+  { { 1.923362e-02f, 2.022228e-03f, 1.411800e-03f }, -1.058850e-01f, 99, 100 }, // 98
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, -7 }, // 99
+  { { 2.646530e-02f, 1.515068e-03f, 6.072510e-04f }, -4.554382e-02f, -33, 101 }, // 100
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, -6.250930e-02f, -33, 102 }, // 101
+  { { 2.633337e-02f, 1.527660e-03f, 6.248603e-04f }, -4.686452e-02f, -33, 103 }, // 102
+  { { 1.895861e-02f, 2.036841e-03f, 1.409710e-03f }, -1.057283e-01f, -33, 104 }, // 103
+  { { 2.733216e-02f, 1.428032e-03f, 4.633389e-04f }, -3.475041e-02f, -33, -1 }, // 104
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, -5.198869e-02f, -33, 106 }, // 105
+  { { 2.646530e-02f, 1.515068e-03f, 6.072510e-04f }, 4.554382e-02f, 107, -32 }, // 106
+  { { 2.733216e-02f, 1.428032e-03f, 4.633389e-04f }, 3.475041e-02f, -1, -32 }, // 107
+  { { 2.115807e-02f, 1.915694e-03f, 1.245058e-03f }, 9.337936e-02f, 109, 174 }, // 108
+  { { 2.414673e-02f, 1.713372e-03f, 9.302888e-04f }, 6.977166e-02f, 110, 159 }, // 109
+  { { 2.723708e-02f, 1.438031e-03f, 4.772941e-04f }, -3.291634e-02f, 111, 118 }, // 110
+  { { 1.923362e-02f, 2.022228e-03f, 1.411800e-03f }, 1.058850e-01f, 112, 116 }, // 111
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 113, -32 }, // 112
+  { { 2.560588e-02f, 1.593897e-03f, 7.314019e-04f }, -5.485514e-02f, -33, 114 }, // 113
+  { { 2.646530e-02f, 1.515068e-03f, 6.072510e-04f }, -4.554382e-02f, -33, 115 }, // 114
+  { { 2.733216e-02f, 1.428032e-03f, 4.633389e-04f }, -3.475041e-02f, -33, -1 }, // 115
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 117, -32 }, // 116
+  { { 2.705036e-02f, 1.457345e-03f, 5.051658e-04f }, -2.894885e-02f, -33, -5 }, // 117
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, 5.112072e-02f, 119, 151 }, // 118
+  { { 1.732341e-02f, 2.113242e-03f, 1.550325e-03f }, 1.162744e-01f, 120, 140 }, // 119
+  { { 2.383536e-02f, 1.736933e-03f, 9.665013e-04f }, 7.248760e-02f, 121, 138 }, // 120
+  { { 2.463261e-02f, 1.675359e-03f, 8.677405e-04f }, 6.508054e-02f, 122, 137 }, // 121
+  { { 2.192218e-02f, 1.868553e-03f, 1.175126e-03f }, 8.813443e-02f, 123, 135 }, // 122
+  { { 2.158303e-02f, 1.889823e-03f, 1.207168e-03f }, 9.053758e-02f, 124, 134 }, // 123
+  { { 1.957023e-02f, 2.004700e-03f, 1.385967e-03f }, 1.039475e-01f, 125, 132 }, // 124
+  { { 1.923362e-02f, 2.022228e-03f, 1.411800e-03f }, 1.058850e-01f, 126, 131 }, // 125
+  { { 2.646530e-02f, 1.515068e-03f, 6.072510e-04f }, 4.554382e-02f, 127, -32 }, // 126
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, 6.250930e-02f, 128, -32 }, // 127
+  { { 2.633337e-02f, 1.527660e-03f, 6.248603e-04f }, 4.686452e-02f, 129, -32 }, // 128
+  { { 1.895861e-02f, 2.036841e-03f, 1.409710e-03f }, 1.057283e-01f, 130, -32 }, // 129
+  { { 2.733216e-02f, 1.428032e-03f, 4.633389e-04f }, 3.475041e-02f, -1, -32 }, // 130
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, -5, -32 }, // 131
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 133, -32 }, // 132
+  { { 1.774845e-02f, 2.094180e-03f, 1.520638e-03f }, 1.140478e-01f, -4, -5 }, // 133
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, -9, -32 }, // 134
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 136, -32 }, // 135
+  { { 2.004570e-02f, 1.979218e-03f, 1.345386e-03f }, 1.009039e-01f, -8, -9 }, // 136
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, -23, -32 }, // 137
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 139, -32 }, // 138
+  { { 2.572884e-02f, 1.582944e-03f, 7.191669e-04f }, 5.393752e-02f, -15, -23 }, // 139
+  { { 1.923362e-02f, 2.022228e-03f, 1.411800e-03f }, 1.058850e-01f, 141, 146 }, // 140
+  { { 2.633337e-02f, 1.527660e-03f, 6.248603e-04f }, 4.686452e-02f, 142, -32 }, // 141
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, 6.250930e-02f, 143, -32 }, // 142
+  { { 2.608049e-02f, 1.551305e-03f, 6.590553e-04f }, 4.942915e-02f, 144, -32 }, // 143
+  { { 2.087954e-02f, 1.932623e-03f, 1.252216e-03f }, 9.391617e-02f, 145, -32 }, // 144
+  { { 2.723708e-02f, 1.438031e-03f, 4.772941e-04f }, 3.579706e-02f, -2, -32 }, // 145
+  { { 2.608049e-02f, 1.551305e-03f, 6.590553e-04f }, 4.942915e-02f, 147, -32 }, // 146
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, 6.250930e-02f, 148, -32 }, // 147
+  { { 2.568781e-02f, 1.586812e-03f, 7.123424e-04f }, 5.342568e-02f, 149, -32 }, // 148
+  { { 2.266187e-02f, 1.820591e-03f, 1.080191e-03f }, 8.101433e-02f, 150, -32 }, // 149
+  { { 2.705036e-02f, 1.457345e-03f, 5.051658e-04f }, 3.788743e-02f, -5, -32 }, // 150
+  { { 2.463261e-02f, 1.675359e-03f, 8.677405e-04f }, 6.508054e-02f, 152, 156 }, // 151
+  { { 2.560588e-02f, 1.593897e-03f, 7.314019e-04f }, 5.485514e-02f, 153, -32 }, // 152
+  { { 2.051669e-02f, 1.953922e-03f, 1.269151e-03f }, 9.518635e-02f, 154, -32 }, // 153
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, 6.717986e-02f, 155, -32 }, // 154
+  { { 2.710568e-02f, 1.451597e-03f, 5.019283e-04f }, 3.764462e-02f, -22, -32 }, // 155
+  { { 2.476203e-02f, 1.665180e-03f, 8.390766e-04f }, 6.293074e-02f, 157, -32 }, // 156
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, 6.717986e-02f, 158, -32 }, // 157
+  { { 2.680921e-02f, 1.481569e-03f, 5.494182e-04f }, 4.120637e-02f, -23, -32 }, // 158
+  { { 2.572884e-02f, 1.582944e-03f, 7.191669e-04f }, 5.393752e-02f, 160, 167 }, // 159
+  { { 2.241967e-02f, 1.836354e-03f, 1.123016e-03f }, 8.422622e-02f, 161, 165 }, // 160
+  { { 2.329963e-02f, 1.776078e-03f, 1.023348e-03f }, 7.675110e-02f, 162, 164 }, // 161
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, 6.717986e-02f, 163, -32 }, // 162
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, 5.112072e-02f, -14, -32 }, // 163
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, -24, -32 }, // 164
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 166, -32 }, // 165
+  { { 2.538773e-02f, 1.612787e-03f, 7.648369e-04f }, 5.736277e-02f, -15, -24 }, // 166
+  { { 2.329963e-02f, 1.776078e-03f, 1.023348e-03f }, 7.675110e-02f, 168, 171 }, // 167
+  { { 2.476203e-02f, 1.665180e-03f, 8.390766e-04f }, 6.293074e-02f, 169, -32 }, // 168
+  { { 2.426331e-02f, 1.704823e-03f, 8.957315e-04f }, 6.717986e-02f, 170, -32 }, // 169
+  { { 2.680921e-02f, 1.481569e-03f, 5.494182e-04f }, 4.120637e-02f, -23, -32 }, // 170
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, 7.614940e-02f, 172, -32 }, // 171
+  { { 2.393970e-02f, 1.729579e-03f, 9.329779e-04f }, 6.997334e-02f, 173, -32 }, // 172
+  { { 2.648353e-02f, 1.513415e-03f, 5.984449e-04f }, 4.488337e-02f, -24, -32 }, // 173
+  { { 2.201922e-02f, 1.862679e-03f, 1.152904e-03f }, 8.646781e-02f, 175, 195 }, // 174
+  { { 2.004570e-02f, 1.979218e-03f, 1.345386e-03f }, 1.009039e-01f, 176, 189 }, // 175
+  { { 2.383536e-02f, 1.736933e-03f, 9.665013e-04f }, 7.248760e-02f, 177, 183 }, // 176
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, -2.110624e-02f, -33, 178 }, // 177
+  { { 2.344044e-02f, 1.765936e-03f, 1.009842e-03f }, 7.573814e-02f, 179, 181 }, // 178
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, 7.614940e-02f, 180, -32 }, // 179
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, 5.112072e-02f, -8, -32 }, // 180
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, 7.614940e-02f, 182, -32 }, // 181
+  { { 2.599335e-02f, 1.559122e-03f, 6.816096e-04f }, 5.112072e-02f, -16, -32 }, // 182
+  { { 2.538773e-02f, 1.612787e-03f, 7.648369e-04f }, 5.736277e-02f, 184, 186 }, // 183
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 185, -32 }, // 184
+  { { 2.084636e-02f, 1.934131e-03f, 1.271605e-03f }, 9.537037e-02f, -15, -16 }, // 185
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, 7.614940e-02f, 187, -32 }, // 186
+  { { 2.393970e-02f, 1.729579e-03f, 9.329779e-04f }, 6.997334e-02f, 188, -32 }, // 187
+  { { 2.648353e-02f, 1.513415e-03f, 5.984449e-04f }, 4.488337e-02f, -24, -32 }, // 188
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, -2.110624e-02f, -33, 190 }, // 189
+  { { 1.844806e-02f, 2.061420e-03f, 1.467869e-03f }, 1.100901e-01f, 191, 193 }, // 190
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, 5.748131e-02f, 192, -32 }, // 191
+  { { 2.344044e-02f, 1.765936e-03f, 1.009842e-03f }, 7.573814e-02f, -9, -16 }, // 192
+  { { 2.477949e-02f, 1.663831e-03f, 8.334573e-04f }, 6.250930e-02f, 194, -32 }, // 193
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, 4.155059e-02f, -10, -32 }, // 194
+  { { 1.844806e-02f, 2.061420e-03f, 1.467869e-03f }, 1.100901e-01f, 196, 204 }, // 195
+  { { 2.501919e-02f, 1.643972e-03f, 8.113526e-04f }, 6.085145e-02f, 197, 200 }, // 196
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, 198, -32 }, // 197
+  { { 2.464085e-02f, 1.674908e-03f, 8.564774e-04f }, 6.423580e-02f, 199, -26 }, // 198
+  { { 1.941917e-02f, 2.012897e-03f, 1.387748e-03f }, 1.040811e-01f, -16, -17 }, // 199
+  { { 2.080189e-02f, 1.937095e-03f, 1.261157e-03f }, 9.458675e-02f, 201, 203 }, // 200
+  { { 2.314305e-02f, 1.787739e-03f, 1.015325e-03f }, 7.614940e-02f, 202, -32 }, // 201
+  { { 2.614366e-02f, 1.545522e-03f, 6.466385e-04f }, 4.849789e-02f, -25, -32 }, // 202
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, -26, -32 }, // 203
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, -2.110624e-02f, 205, 208 }, // 204
+  { { 2.464085e-02f, 1.674908e-03f, 8.564774e-04f }, 6.423580e-02f, 206, 207 }, // 205
+  { { 2.625288e-02f, 1.535431e-03f, 6.249732e-04f }, -7.107096e-03f, -33, -17 }, // 206
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 1.379311e-02f, -33, -26 }, // 207
+  { { 2.302174e-02f, 1.795655e-03f, 1.053204e-03f }, 7.899028e-02f, 209, 213 }, // 208
+  { { 2.568781e-02f, 1.586812e-03f, 7.123424e-04f }, 5.342568e-02f, 210, -32 }, // 209
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, 5.748131e-02f, 211, -32 }, // 210
+  { { 2.418980e-02f, 1.710423e-03f, 9.083385e-04f }, 6.812539e-02f, 212, -32 }, // 211
+  { { 2.672566e-02f, 1.489969e-03f, 5.540079e-04f }, 4.155059e-02f, -10, -32 }, // 212
+  { { 2.464085e-02f, 1.674908e-03f, 8.564774e-04f }, 6.423580e-02f, 214, 216 }, // 213
+  { { 2.528911e-02f, 1.621449e-03f, 7.664175e-04f }, 5.748131e-02f, 215, -32 }, // 214
+  { { 2.625288e-02f, 1.535431e-03f, 6.249732e-04f }, 4.687299e-02f, -17, -32 }, // 215
+  { { 2.579630e-02f, 1.577222e-03f, 6.931825e-04f }, 5.198869e-02f, -26, -32 }, // 216
+};
+
+static const ExplicitMpcLaw jump_mpc_flight_laws[] = {
+  { { 4.719165e+00f, 2.465637e-01f, 8.000000e-02f }, 0.000000e+00f }, // 0
+  { { 4.756641e+00f, 2.511354e-01f, 8.335389e-02f }, -2.515418e-01f }, // 1
+  { { 4.756641e+00f, 2.511354e-01f, 8.335389e-02f }, 2.515418e-01f }, // 2
+  { { 4.792212e+00f, 2.540464e-01f, 8.517322e-02f }, -3.879914e-01f }, // 3
+  { { 4.856708e+00f, 2.616565e-01f, 9.069908e-02f }, -8.024308e-01f }, // 4
+  { { 4.792212e+00f, 2.540464e-01f, 8.517322e-02f }, 3.879914e-01f }, // 5
+  { { 4.856708e+00f, 2.616565e-01f, 9.069908e-02f }, 8.024308e-01f }, // 6
+  { { 4.875314e+00f, 2.598732e-01f, 8.837026e-02f }, -6.277698e-01f }, // 7
+  { { 5.005039e+00f, 2.726817e-01f, 9.707693e-02f }, -1.280770e+00f }, // 8
+  { { 5.118482e+00f, 2.853579e-01f, 1.061033e-01f }, -1.957745e+00f }, // 9
+  { { 4.875314e+00f, 2.598732e-01f, 8.837026e-02f }, 6.277698e-01f }, // 10
+  { { 5.005039e+00f, 2.726817e-01f, 9.707693e-02f }, 1.280770e+00f }, // 11
+  { { 5.118482e+00f, 2.853579e-01f, 1.061033e-01f }, 1.957745e+00f }, // 12
+  { { 5.086340e+00f, 2.726172e-01f, 9.414597e-02f }, -1.060948e+00f }, // 13
+  { { 5.377822e+00f, 2.964920e-01f, 1.087465e-01f }, -2.155989e+00f }, // 14
+  { { 5.622850e+00f, 3.192258e-01f, 1.236930e-01f }, -3.276971e+00f }, // 15
+  { { 5.836125e+00f, 3.413328e-01f, 1.389342e-01f }, -4.420063e+00f }, // 16
+  { { 5.086340e+00f, 2.726172e-01f, 9.414597e-02f }, 1.060948e+00f }, // 17
+  { { 5.377822e+00f, 2.964920e-01f, 1.087465e-01f }, 2.155989e+00f }, // 18
+  { { 5.622850e+00f, 3.192258e-01f, 1.236930e-01f }, 3.276971e+00f }, // 19
+  { { 5.836125e+00f, 3.413328e-01f, 1.389342e-01f }, 4.420063e+00f }, // 20
+  { { 5.677886e+00f, 3.040693e-01f, 1.051400e-01f }, -1.885503e+00f }, // 21
+  { { 6.439439e+00f, 3.558655e-01f, 1.319675e-01f }, -3.897563e+00f }, // 22
+  { { 7.074565e+00f, 4.042797e-01f, 1.598630e-01f }, -5.989725e+00f }, // 23
+  { { 7.621883e+00f, 4.505791e-01f, 1.885200e-01f }, -8.139001e+00f }, // 24
+  { { 8.104487e+00f, 4.955198e-01f, 2.177789e-01f }, -1.033342e+01f }, // 25
+  { { 5.677886e+00f, 3.040693e-01f, 1.051400e-01f }, 1.885503e+00f }, // 26
+  { { 6.439439e+00f, 3.558655e-01f, 1.319675e-01f }, 3.897563e+00f }, // 27
+  { { 7.074565e+00f, 4.042797e-01f, 1.598630e-01f }, 5.989725e+00f }, // 28
+  { { 7.621883e+00f, 4.505791e-01f, 1.885200e-01f }, 8.139001e+00f }, // 29
+  { { 8.104487e+00f, 4.955198e-01f, 2.177789e-01f }, 1.033342e+01f }, // 30
+  { { 0.000000e+00f, 0.000000e+00f, 0.000000e+00f }, 6.000000e+00f }, // 31
+  { { 0.000000e+00f, 0.000000e+00f, 0.000000e+00f }, -6.000000e+00f }, // 32
+};
+
+static const ExplicitMpcTable jump_mpc_flight = {
+  jump_mpc_flight_nodes, jump_mpc_flight_laws, { 30.0f, 400.0f, 80.0f }, 6.0f, 0, 17
+};
@@ -0,0 +1,128 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+
+#include "jump_sequencer.hpp"
+
+bool JumpSequencer::load(const JumpPhase* phases, const uint8_t count, const uint16_t interval) {
+  if (count == 0 || count > MAX_PHASES || interval == 0) {
+    return false;
+  }
+
+  uint16_t offset = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    const JumpPhase& phase = phases[i];
+    const uint16_t length = phase.duration > interval ? phase.duration / interval : 1;
+    offset_[i] = offset;
+    length_[i] = length;
+    if (phase.leg != JumpLeg::MIN_JERK) {
+      continue;
+    }
+    if (offset + length > PROFILE_SIZE) {
+      return false;
+    }
+    // 最小加加速度曲线 10τ³ - 15τ⁴ + 6τ⁵，第 k 拍取阶段内 (k + 1) / length 处的值，最后一拍正好到达目标
+    for (uint16_t k = 0; k < length; k++) {
+      const float tau = static_cast<float>(k + 1) / static_cast<float>(length);
+      profile_[offset + k] = tau * tau * tau * (10 + tau * (-15 + tau * 6));
+    }
+    offset += length;
+  }
+
+  phases_ = phases;
+  count_ = count;
+  return true;
+}
+
+bool JumpSequencer::start(const float height) {
+  if (phases_ == nullptr || active()) {
+    return false;
+  }
+  start_height_ = height;
+  height_ = height;
+  enter(0);
+  return true;
+}
+
+void JumpSequencer::abort() {
+  index_.store(-1, std::memory_order_release);
+}
+
+void JumpSequencer::enter(const int8_t index) {
+  ticks_ = 0;
+  from_ = height_;
+  if (index >= 0 && index < count_) {
+    const JumpPhase& phase = phases_[index];
+    if (phase.leg == JumpLeg::STEP) {
+      height_ = phase.height;
+    }
+    else if (phase.leg == JumpLeg::MIN_JERK) {
+      height_ = from_ + (phase.height - from_) * profile_[offset_[index]];
+    }
+    index_.store(index, std::memory_order_release);
+  }
+  else {
+    index_.store(-1, std::memory_order_release);
+  }
+}
+
+void JumpSequencer::update(const bool lifted_off, const bool landed) {
+  const int8_t index = index_.load(std::memory_order_relaxed);
+  if (index < 0) {
+    return;
+  }
+
+  const JumpPhase& phase = phases_[index];
+  const bool event = (phase.exit == JumpExit::LIFT_OFF && lifted_off)
+                     || (phase.exit == JumpExit::TOUCH_DOWN && landed);
+  if (event) {
+    enter(static_cast<int8_t>(index + 1));
+    return;
+  }
+
+  if (++ticks_ >= length_[index]) {
+    if (phase.exit == JumpExit::TIMEOUT || phase.timeout_next < 0) {
+      enter(static_cast<int8_t>(index + 1));
+    }
+    else {
+      enter(phase.timeout_next);
+    }
+    return;
+  }
+
+  if (phase.leg == JumpLeg::MIN_JERK) {
+    height_ = from_ + (phase.height - from_) * profile_[offset_[index] + ticks_];
+  }
+}
+
+bool JumpSequencer::leg_command(float* height, uint16_t* speed, uint8_t* acceleration) const {
+  const int8_t index = index_.load(std::memory_order_relaxed);
+  if (index < 0) {
+    return false;
+  }
+  const JumpPhase& phase = phases_[index];
+  if (phase.leg == JumpLeg::RELEASE) {
+    return false;
+  }
+  // STEP 只在进入阶段时下发一次，MIN_JERK 每拍下发
+  if (ticks_ == 0 || phase.leg == JumpLeg::MIN_JERK) {
+    *height = height_;
+    *speed = phase.servo_speed;
+    *acceleration = phase.servo_acceleration;
+    return true;
+  }
+  return false;
+}
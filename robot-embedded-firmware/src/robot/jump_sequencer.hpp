@@ -0,0 +1,150 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+
+#pragma once
+
+#include <atomic>
+
+#include "defs.h"
+
+/** @brief 阶段内的控制方式 */
+enum class JumpControl : uint8_t {
+  BALANCE, // 平衡环全部四项，与站立时相同
+  MPC,     // 显式 MPC，按着地、腾空查表
+};
+
+/** @brief 阶段的腿部动作 */
+enum class JumpLeg : uint8_t {
+  STEP,     // 进入阶段时一次下发目标，由舵机按给定速度、加速度执行
+  MIN_JERK, // 按预先生成的最小加加速度曲线逐拍下发
+  RELEASE,  // 结束直接控制，交还轨迹规划回到起跳前的腿高
+};
+
+/** @brief 提前结束阶段的事件 */
+enum class JumpExit : uint8_t {
+  TIMEOUT,    // 只按时长
+  LIFT_OFF,   // 离地
+  TOUCH_DOWN, // 着地
+};
+
+/**
+ * @brief 跳跃动作表中的一个阶段
+ */
+struct JumpPhase {
+  const char* name;
+  uint16_t duration;          // 最长时长，单位：毫秒
+  JumpExit exit;              // 提前结束的事件，发生后进入下一阶段
+  int8_t timeout_next;        // 超时仍未等到事件时进入的阶段，-1 表示下一阶段
+  JumpLeg leg;
+  float height;               // 阶段结束时的腿高，单位：%
+  uint16_t servo_speed;       // 舵机速度，单位：计数/秒
+  uint8_t servo_acceleration; // 舵机加速度，0 表示不限
+  JumpControl control;
+  bool yaw;                   // 是否保留转向和航向保持，轮子离地后差速没有意义
+};
+
+/**
+ * @brief 跳跃动作执行器
+ *
+ * 按预先写好的阶段表在控制环中逐拍推进：蹲下蓄力、蹬腿、腾空收腿、落地缓冲、恢复。
+ * 各阶段的腿高曲线在 load() 时一次生成到固定缓冲区，运行时只查表，不分配内存，也不访问舵机总线。
+ * 阶段切换只取决于节拍数和着地检测的事件，同样的输入总是得到同样的时序。
+ *
+ * start()、update() 只在控制环中调用；active()、mpc()、yaw() 可在其他任务中读取。
+ */
+class JumpSequencer {
+public:
+  static constexpr uint8_t MAX_PHASES = 8;
+  static constexpr uint16_t PROFILE_SIZE = 256;
+
+  /**
+   * @brief 载入阶段表并生成腿高曲线
+   * @param phases 阶段表，需在执行期间一直有效
+   * @param count 阶段数
+   * @param interval 控制周期，单位：毫秒
+   * @return false 表示阶段过多或曲线超出缓冲区
+   */
+  bool load(const JumpPhase* phases, uint8_t count, uint16_t interval);
+
+  /**
+   * @brief 从第一个阶段开始
+   * @param height 起跳前的腿高，单位：%，恢复阶段回到该高度
+   * @return false 表示未载入阶段表或正在执行
+   */
+  bool start(float height);
+
+  /** @brief 立即结束 */
+  void abort();
+
+  /**
+   * @brief 推进一个控制周期
+   * @param lifted_off 本周期是否检测到离地
+   * @param landed 本周期是否检测到着地
+   */
+  void update(bool lifted_off, bool landed);
+
+  bool active() const {
+    return index_.load(std::memory_order_acquire) >= 0;
+  }
+
+  /** @brief 当前阶段是否使用显式 MPC */
+  bool mpc() const {
+    const int8_t index = index_.load(std::memory_order_acquire);
+    return index >= 0 && phases_[index].control == JumpControl::MPC;
+  }
+
+  /** @brief 当前阶段是否保留转向，未在跳跃时总是保留 */
+  bool yaw() const {
+    const int8_t index = index_.load(std::memory_order_acquire);
+    return index < 0 || phases_[index].yaw;
+  }
+
+  /** @brief 本周期是否刚进入恢复阶段，需要把腿交还轨迹规划 */
+  bool releasing() const {
+    const int8_t index = index_.load(std::memory_order_acquire);
+    return index >= 0 && ticks_ == 0 && phases_[index].leg == JumpLeg::RELEASE;
+  }
+
+  /**
+   * @brief 本周期需要下发的腿部指令
+   * @param height 腿高，单位：%
+   * @param speed 舵机速度，单位：计数/秒
+   * @param acceleration 舵机加速度
+   * @return false 表示腿部指令与上一周期相同，无需下发
+   */
+  bool leg_command(float* height, uint16_t* speed, uint8_t* acceleration) const;
+
+  /** @brief 起跳前的腿高，单位：% */
+  float start_height() const {
+    return start_height_;
+  }
+
+private:
+  void enter(int8_t index);
+
+  const JumpPhase* phases_ = nullptr;
+  uint8_t count_ = 0;
+  uint16_t offset_[MAX_PHASES] = {};    // 各阶段曲线在 profile_ 中的起点
+  uint16_t length_[MAX_PHASES] = {};    // 各阶段的节拍数
+  float profile_[PROFILE_SIZE] = {};    // 阶段内的归一化进度，0 为阶段起点的腿高，1 为目标腿高
+
+  std::atomic<int8_t> index_{ -1 };
+  uint16_t ticks_ = 0;
+  float from_ = 0;         // 阶段起点的腿高
+  float height_ = 0;       // 当前腿高指令
+  float start_height_ = 0;
+};
@@ -15,16 +15,36 @@
 
 #include "robot/leg.h"
 
+#include <cmath>
+
 #include "logging.hpp"
 #include "robot.hpp"
 #include "STSServoDriver.hpp"
+#include "leg_trajectory.hpp"
+#include "input_shaper.hpp"
+#include "leg_kinematics_table.h"
+#include "snapshot.hpp"
+#include "esp/misc.hpp"
+#include "esp/storage.hpp"
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "robot/stats.h"
 
 static auto TAG = "robot-leg";
 
 STSServoDriver servos;
 
+[[noreturn]]
+static void leg_telemetry_task(void*);
+
+[[noreturn]]
+static void leg_scheduler_task(void*);
+
+[[noreturn]]
+static void leg_trajectory_task(void*);
+
+static void leg_schedule(float left_percentage, float right_percentage);
+
 #define LEFT  1
 #define RIGHT 2
 #define numberOfServos 2
@@ -41,11 +61,90 @@ STSServoDriver servos;
 #define SERVO_LEFT_ACC 100 // 舵机1加速度，不能太快，否则影响其他动作平衡
 #define SERVO_RIGHT_ACC 100 // 舵机2加速度
 
-#define SERVO_LEFT_SPEED 800 // 舵机1速度，不能太快，否则影响其他动作平衡
-#define SERVO_RIGHT_SPEED 800 // 舵机2速度
+#define SERVO_LEFT_SPEED 1600 // 舵机1速度上限，平滑由轨迹生成器保证，这里只需跟得上轨迹
+#define SERVO_RIGHT_SPEED 1600 // 舵机2速度上限
+
+#define LEG_TELEMETRY_INTERVAL 20 // 遥测周期，单位：毫秒
+#define LEG_TELEMETRY_CORE 0      // 与平衡环(core 1)错开
+#define LEG_TELEMETRY_TIMEOUT 200 // 超过该时间未更新则视为失效，单位：毫秒
+
+#define LEG_FRAME_RATE_DEFAULT 50 // 舵机总线每秒最多发送的 SYNC WRITE 帧数
+#define LEG_FRAME_RATE_MAX 200
+
+#define LEG_TRAJECTORY_INTERVAL 20             // 轨迹采样周期，单位：毫秒，与默认帧率一致
+#define LEG_TRAJECTORY_MAX_VELOCITY 250.0f     // 单位：%/s
+#define LEG_TRAJECTORY_MAX_ACCELERATION 1500.0f // 单位：%/s²，不超过舵机 TARGET_ACCELERATION 的能力
+#define LEG_TRAJECTORY_MIN_DURATION 0.1f       // 单位：秒
+
+// 腿高变化激起的俯仰振型，输入整形按此抵消残余晃动。默认值只是估计，
+// 按实测的俯仰自由振荡通过 MESSAGE_CONFIG_SET（SHAPER）标定，保存在 NVS 中
+#define LEG_SHAPER_FREQUENCY 2.0f // 固有频率，单位：Hz
+#define LEG_SHAPER_DAMPING 0.2f   // 阻尼比
+#define LEG_SHAPER_MAX_FREQUENCY 10.0f
+#define LEG_SHAPER_NAMESPACE "robot"
+#define LEG_SHAPER_KEY "leg_shaper"
 
 constexpr static byte ID[2] = { 1, 2 };
 
+static Snapshot<robot_leg_telemetry_t> telemetry_snapshot;
+static Snapshot<robot_leg_plan_t> plan_snapshot;
+
+// 左右腿各自的腿高轨迹，单位：百分比，受 scheduler.lock 保护
+static MinJerkTrajectory left_trajectory(LEG_TRAJECTORY_MAX_VELOCITY, LEG_TRAJECTORY_MAX_ACCELERATION, LEG_TRAJECTORY_MIN_DURATION);
+static MinJerkTrajectory right_trajectory(LEG_TRAJECTORY_MAX_VELOCITY, LEG_TRAJECTORY_MAX_ACCELERATION, LEG_TRAJECTORY_MIN_DURATION);
+static TaskHandle_t trajectory_task = nullptr;
+
+// 轨迹采样再经过 ZV 整形后才下发：参数是标定出来的，不需要 ZVD 的频率容差，延迟少半个周期
+static InputShaper left_shaper(LEG_TRAJECTORY_INTERVAL / 1000.0f);
+static InputShaper right_shaper(LEG_TRAJECTORY_INTERVAL / 1000.0f);
+
+// 整形参数，按此结构保存在 NVS 中
+typedef struct {
+  float frequency;
+  float damping;
+} leg_shaper_t;
+
+static leg_shaper_t leg_shaper_load();
+static void leg_shaper_configure(leg_shaper_t shaper);
+
+/**
+ * 舵机指令调度：所有目标位置只写入这里，由调度任务合并后以一帧 SYNC WRITE
+ * 同时下发两个舵机。两帧之间到达的新指令直接覆盖旧指令，总线上不会积压过时的位置。
+ * 每条腿的目标 = 轨迹给出的基础腿高 + 其他控制环（横滚等）叠加的偏移。
+ * 直接控制（跳跃）时两腿只跟随 direct_height，忽略轨迹和偏移，且不受帧率限制。
+ */
+static struct {
+  portMUX_TYPE lock;
+  bool dirty;                  // 有尚未下发的目标
+  float left_base;             // 基础腿高，单位：%
+  float right_base;
+  float left_offset[leg_offset_count]; // 各来源叠加的偏移，单位：%
+  float right_offset[leg_offset_count];
+  uint32_t frame_interval;     // 两帧之间的最小间隔，单位：微秒
+  uint64_t last_frame_time;    // 上一帧的发送时间，单位：微秒
+  uint32_t superseded;         // 被覆盖而未下发的指令数
+  bool direct;                 // 直接控制，跳过轨迹规划
+  float direct_height;         // 单位：%
+  int direct_speed;            // 舵机速度，单位：计数/秒
+  byte direct_acceleration;    // 舵机加速度，0 表示不限
+  TaskHandle_t task;
+} scheduler = {
+  .lock = portMUX_INITIALIZER_UNLOCKED,
+  .dirty = false,
+  .left_base = 50,
+  .right_base = 50,
+  .left_offset = {},
+  .right_offset = {},
+  .frame_interval = 1000000 / LEG_FRAME_RATE_DEFAULT,
+  .last_frame_time = 0,
+  .superseded = 0,
+  .direct = false,
+  .direct_height = 50,
+  .direct_speed = SERVO_LEFT_SPEED,
+  .direct_acceleration = SERVO_LEFT_ACC,
+  .task = nullptr,
+};
+
 static struct {
   byte left_acceleration;
   byte right_acceleration;
@@ -73,7 +172,14 @@ static struct {
 void robot_leg_init() {
   log_info("robot legs initializing");
 
-  if (!servos.init(&serial2, 1000000)) {
+  left_trajectory.reset(handle.left_position_percentage);
+  right_trajectory.reset(handle.right_position_percentage);
+  leg_shaper_configure(leg_shaper_load());
+  left_shaper.reset(handle.left_position_percentage);
+  right_shaper.reset(handle.right_position_percentage);
+  xTaskCreatePinnedToCore(leg_scheduler_task, "leg_scheduler", 2048, nullptr, 7, &scheduler.task, LEG_TELEMETRY_CORE);
+
+  if (!servos.init(&serial2, ID, numberOfServos, 1000000)) {
     log_error("robot legs init failed");
   }
   else {
@@ -83,15 +189,342 @@ void robot_leg_init() {
 
     robot_leg_set_speed(SERVO_LEFT_SPEED, SERVO_RIGHT_SPEED);
     robot_leg_set_acceleration(SERVO_RIGHT_ACC);
-    robot_leg_set_height_percentage(50);
+    // 轨迹起点即初始姿态，直接下发一次
+    leg_schedule(handle.left_position_percentage, handle.right_position_percentage);
   }
 
+  xTaskCreatePinnedToCore(leg_trajectory_task, "leg_trajectory", 3072, nullptr, 7, &trajectory_task, LEG_TELEMETRY_CORE);
+
+  xTaskCreatePinnedToCore(leg_telemetry_task, "leg_telemetry", 3072, nullptr, 6, nullptr, LEG_TELEMETRY_CORE);
+
   stats_register_callback([](status_report_t* report, void*)-> bool {
     report->robot_height = { robot_leg_get_height_percentage() };
     return true;
   }, status_robot_height, nullptr, 3000);
 }
 
+static uint8_t leg_height_from_position(const int left_position, const int right_position) {
+  const int left = mapi(left_position, SERVO_LEFT_MIN, SERVO_LEFT_MAX, 0, 100);
+  const int right = mapi(right_position, SERVO_RIGHT_MIN, SERVO_RIGHT_MAX, 0, 100);
+  return constrain((left + right) / 2, 0, 100);
+}
+
+[[noreturn]]
+static void leg_telemetry_task(void*) {
+  STSTelemetry servo_telemetry[numberOfServos];
+  robot_leg_telemetry_t telemetry;
+  uint32_t failures = 0;
+
+  TickType_t last_wake_time = xTaskGetTickCount();
+  for (;;) {
+    vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(LEG_TELEMETRY_INTERVAL));
+
+    // 一次 SYNC READ 同时读取两个舵机的位置、速度、负载、电压和温度
+    if (const int rc = servos.readTelemetry(numberOfServos, ID, servo_telemetry); rc != 0) {
+      if (++failures % 50 == 1) {
+        log_warn("leg telemetry read failed: %d", rc);
+      }
+      continue;
+    }
+
+    for (int i = 0; i < numberOfServos; i++) {
+      robot_leg_servo_telemetry_t& leg = ID[i] == LEFT ? telemetry.left : telemetry.right;
+      leg = {
+        .position = servo_telemetry[i].position,
+        .speed = servo_telemetry[i].speed,
+        .load = servo_telemetry[i].load,
+        .voltage = servo_telemetry[i].voltage,
+        .temperature = servo_telemetry[i].temperature
+      };
+    }
+    telemetry.height_percentage = leg_height_from_position(telemetry.left.position, telemetry.right.position);
+    telemetry.timestamp = millis();
+    telemetry_snapshot.publish(telemetry);
+  }
+}
+
+bool robot_leg_get_telemetry(robot_leg_telemetry_t* telemetry) {
+  return telemetry_snapshot.load(*telemetry);
+}
+
+[[noreturn]]
+static void leg_scheduler_task(void*) {
+  int positions[numberOfServos];
+  int speeds[numberOfServos];
+  byte accelerations[numberOfServos];
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // 帧率限制：等待期间到达的指令会合并进同一帧；跳跃动作的时序不能等
+    const uint64_t next_frame_time = scheduler.last_frame_time + scheduler.frame_interval;
+    if (const uint64_t now = micros(); !scheduler.direct && now < next_frame_time) {
+      vTaskDelay(pdMS_TO_TICKS((next_frame_time - now + 999) / 1000));
+    }
+
+    taskENTER_CRITICAL(&scheduler.lock);
+    const bool dirty = scheduler.dirty;
+    scheduler.dirty = false;
+    float left = scheduler.left_base;
+    float right = scheduler.right_base;
+    for (int i = 0; i < leg_offset_count; i++) {
+      left += scheduler.left_offset[i];
+      right += scheduler.right_offset[i];
+    }
+    if (scheduler.direct) {
+      left = right = scheduler.direct_height;
+    }
+    left = constrain(left, 0.0f, 100.0f);
+    right = constrain(right, 0.0f, 100.0f);
+    handle.left_position = lroundf(mapf(left, 0, 100, SERVO_LEFT_MIN, SERVO_LEFT_MAX));
+    handle.right_position = lroundf(mapf(right, 0, 100, SERVO_RIGHT_MIN, SERVO_RIGHT_MAX));
+    positions[0] = handle.left_position;
+    positions[1] = handle.right_position;
+    speeds[0] = scheduler.direct ? scheduler.direct_speed : handle.left_speed;
+    speeds[1] = scheduler.direct ? scheduler.direct_speed : handle.right_speed;
+    accelerations[0] = scheduler.direct ? scheduler.direct_acceleration : handle.left_acceleration;
+    accelerations[1] = scheduler.direct ? scheduler.direct_acceleration : handle.right_acceleration;
+    taskEXIT_CRITICAL(&scheduler.lock);
+
+    if (dirty) {
+      if (servos.setTargetPositions(numberOfServos, ID, positions, speeds, accelerations)) {
+        scheduler.last_frame_time = micros();
+      }
+      else {
+        // 总线队列已满，这一帧没有发出去：重新标记，等一个节拍后再发（期间的新目标会合并进来）
+        taskENTER_CRITICAL(&scheduler.lock);
+        scheduler.dirty = true;
+        taskEXIT_CRITICAL(&scheduler.lock);
+        vTaskDelay(1);
+        xTaskNotifyGive(scheduler.task);
+      }
+    }
+  }
+}
+
+/**
+ * @brief 标记有新目标并唤醒调度任务，调用方需持有 scheduler.lock
+ */
+static void leg_schedule_locked() {
+  if (scheduler.dirty) {
+    scheduler.superseded++;
+  }
+  scheduler.dirty = true;
+}
+
+/**
+ * @brief 更新基础腿高并唤醒调度任务，不直接访问总线
+ * @param left_percentage 左腿高度百分比，负数表示不变
+ * @param right_percentage 右腿高度百分比，负数表示不变
+ */
+static void leg_schedule(const float left_percentage, const float right_percentage) {
+  taskENTER_CRITICAL(&scheduler.lock);
+  if (left_percentage >= 0) {
+    scheduler.left_base = left_percentage;
+  }
+  if (right_percentage >= 0) {
+    scheduler.right_base = right_percentage;
+  }
+  leg_schedule_locked();
+  taskEXIT_CRITICAL(&scheduler.lock);
+
+  if (scheduler.task) {
+    xTaskNotifyGive(scheduler.task);
+  }
+}
+
+void robot_leg_set_height_offset(const leg_offset_source_t source, const float left_offset, const float right_offset) {
+  if (source >= leg_offset_count) {
+    return;
+  }
+  taskENTER_CRITICAL(&scheduler.lock);
+  scheduler.left_offset[source] = left_offset;
+  scheduler.right_offset[source] = right_offset;
+  leg_schedule_locked();
+  taskEXIT_CRITICAL(&scheduler.lock);
+
+  if (scheduler.task) {
+    xTaskNotifyGive(scheduler.task);
+  }
+}
+
+/**
+ * @brief 由计划腿高查表得到质心位置和平衡角度
+ *
+ * 计划点就是下发给舵机的指令，比遥测反馈的实测位置早一个舵机响应加 20ms 采样周期，
+ * 平衡控制按它给前馈，质心还没动之前就开始调整平衡角度。
+ */
+static void leg_plan_com(robot_leg_plan_t* plan) {
+  robot_leg_kinematics_t kinematics;
+  robot_leg_kinematics_lookup(plan->height, &kinematics);
+  plan->com_offset = kinematics.com_offset;
+  plan->com_height = kinematics.com_height;
+  plan->pitch_offset = kinematics.pitch_offset;
+}
+
+[[noreturn]]
+static void leg_trajectory_task(void*) {
+  robot_leg_plan_t plan;
+
+  TickType_t last_wake_time = xTaskGetTickCount();
+  for (;;) {
+    const uint64_t now = micros();
+
+    taskENTER_CRITICAL(&scheduler.lock);
+    left_trajectory.sample(now);
+    right_trajectory.sample(now);
+    const InputShaper::Sample left = left_shaper.update({
+      left_trajectory.position(), left_trajectory.velocity(), left_trajectory.acceleration()
+    });
+    const InputShaper::Sample right = right_shaper.update({
+      right_trajectory.position(), right_trajectory.velocity(), right_trajectory.acceleration()
+    });
+    // 轨迹结束后整形器还要把延迟的脉冲走完
+    const bool active = left_trajectory.active() || right_trajectory.active()
+                        || !left_shaper.settled() || !right_shaper.settled();
+    plan = {
+      .height = (left.position + right.position) / 2,
+      .velocity = (left.velocity + right.velocity) / 2,
+      .acceleration = (left.acceleration + right.acceleration) / 2,
+    };
+    taskEXIT_CRITICAL(&scheduler.lock);
+
+    leg_plan_com(&plan);
+    plan_snapshot.publish(plan);
+
+    if (active) {
+      leg_schedule(left.position, right.position);
+      vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(LEG_TRAJECTORY_INTERVAL));
+    }
+    else {
+      // 轨迹结束后的最后一个采样点已经下发，等待新的目标
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      last_wake_time = xTaskGetTickCount();
+    }
+  }
+}
+
+/**
+ * @brief 以当前状态为起点重新规划腿高轨迹
+ * @param left_percentage 左腿目标，负数表示不变
+ * @param right_percentage 右腿目标，负数表示不变
+ */
+static void leg_plan(const int left_percentage, const int right_percentage) {
+  const uint64_t now = micros();
+  bool changed = false;
+
+  taskENTER_CRITICAL(&scheduler.lock);
+  // 高频调用时目标往往不变，不重复规划
+  if (left_percentage >= 0 && left_percentage != handle.left_position_percentage) {
+    handle.left_position_percentage = left_percentage;
+    left_trajectory.retarget(left_percentage, now);
+    changed = true;
+  }
+  if (right_percentage >= 0 && right_percentage != handle.right_position_percentage) {
+    handle.right_position_percentage = right_percentage;
+    right_trajectory.retarget(right_percentage, now);
+    changed = true;
+  }
+  taskEXIT_CRITICAL(&scheduler.lock);
+
+  if (changed && trajectory_task) {
+    xTaskNotifyGive(trajectory_task);
+  }
+}
+
+void robot_leg_set_direct(const float percentage, const uint16_t speed, const uint8_t acceleration) {
+  taskENTER_CRITICAL(&scheduler.lock);
+  scheduler.direct = true;
+  scheduler.direct_height = constrain(percentage, 0.0f, 100.0f);
+  scheduler.direct_speed = speed;
+  scheduler.direct_acceleration = acceleration;
+  leg_schedule_locked();
+  taskEXIT_CRITICAL(&scheduler.lock);
+
+  if (scheduler.task) {
+    xTaskNotifyGive(scheduler.task);
+  }
+}
+
+void robot_leg_release_direct(uint8_t percentage) {
+  percentage = constrain(percentage, 0, 100);
+
+  taskENTER_CRITICAL(&scheduler.lock);
+  if (scheduler.direct) {
+    // 轨迹和整形器从直接控制结束时的腿高重新开始，不会跳回跳跃前的计划
+    const float height = scheduler.direct_height;
+    scheduler.direct = false;
+    scheduler.left_base = height;
+    scheduler.right_base = height;
+    left_trajectory.reset(height);
+    right_trajectory.reset(height);
+    left_shaper.reset(height);
+    right_shaper.reset(height);
+    handle.left_position_percentage = lroundf(height);
+    handle.right_position_percentage = lroundf(height);
+    leg_schedule_locked();
+  }
+  taskEXIT_CRITICAL(&scheduler.lock);
+
+  if (scheduler.task) {
+    xTaskNotifyGive(scheduler.task);
+  }
+  leg_plan(percentage, percentage);
+}
+
+bool robot_leg_get_plan(robot_leg_plan_t* plan) {
+  return plan_snapshot.load(*plan);
+}
+
+/**
+ * @param travel 舵机相对最低位置的行程，单位：计数
+ */
+static void leg_kinematics_from_travel(float travel, robot_leg_kinematics_t* kinematics) {
+  travel = constrain(travel, 0.0f, (float) LEG_KINEMATICS_TRAVEL_MAX);
+
+  const float position = travel / (1 << LEG_KINEMATICS_STEP_SHIFT);
+  const int index = (int) position;
+  const float fraction = position - (float) index;
+
+  // 表格末尾多生成了一项，index + 1 不会越界
+  const float* a = leg_kinematics_table[index];
+  const float* b = leg_kinematics_table[index + 1];
+  kinematics->height = a[0] + (b[0] - a[0]) * fraction;
+  kinematics->com_offset = a[1] + (b[1] - a[1]) * fraction;
+  kinematics->com_height = a[2] + (b[2] - a[2]) * fraction;
+  kinematics->pitch_offset = a[3] + (b[3] - a[3]) * fraction;
+}
+
+void robot_leg_kinematics_lookup(const float percentage, robot_leg_kinematics_t* kinematics) {
+  const float left = mapf(percentage, 0, 100, 0, abs(SERVO_LEFT_MAX - SERVO_LEFT_MIN));
+  const float right = mapf(percentage, 0, 100, 0, abs(SERVO_RIGHT_MAX - SERVO_RIGHT_MIN));
+  leg_kinematics_from_travel((left + right) / 2, kinematics);
+}
+
+bool robot_leg_kinematics_measured() {
+  return LEG_KINEMATICS_MEASURED != 0;
+}
+
+void robot_leg_get_kinematics(robot_leg_kinematics_t* kinematics) {
+  if (robot_leg_telemetry_t telemetry; telemetry_snapshot.load(telemetry)
+    && static_cast<uint32_t>(millis()) - telemetry.timestamp < LEG_TELEMETRY_TIMEOUT) {
+    const int left = (telemetry.left.position - SERVO_LEFT_MIN) * (SERVO_LEFT_MAX > SERVO_LEFT_MIN ? 1 : -1);
+    const int right = (telemetry.right.position - SERVO_RIGHT_MIN) * (SERVO_RIGHT_MAX > SERVO_RIGHT_MIN ? 1 : -1);
+    leg_kinematics_from_travel((float) (left + right) / 2, kinematics);
+    return;
+  }
+
+  robot_leg_plan_t plan;
+  if (!plan_snapshot.load(plan)) {
+    plan.height = handle.right_position_percentage;
+  }
+  robot_leg_kinematics_lookup(plan.height, kinematics);
+}
+
+void robot_leg_set_frame_rate(const uint16_t frames_per_second) {
+  scheduler.frame_interval = 1000000 / constrain(frames_per_second, 1, LEG_FRAME_RATE_MAX);
+}
+
 void robot_leg_set_acceleration(const uint8_t acceleration) {
   handle.left_acceleration = acceleration;
   handle.right_acceleration = acceleration;
@@ -100,54 +533,61 @@ void robot_leg_set_acceleration(const uint8_t acceleration) {
 }
 
 void robot_leg_set_speed(const int left_speed, const int right_speed) {
+  // 速度随 SYNC WRITE 一起下发（TARGET_POSITION 之后即 RUNNING_SPEED）
+  taskENTER_CRITICAL(&scheduler.lock);
   handle.left_speed = left_speed;
   handle.right_speed = right_speed;
-
-  servos.setTargetVelocity(LEFT, left_speed);
-  servos.setTargetVelocity(RIGHT, right_speed);
+  taskEXIT_CRITICAL(&scheduler.lock);
 }
 
-void robot_leg_set_height_percentage(uint8_t percentage) {
-  percentage = constrain(percentage, 0, 100);
-
-  const uint16_t left_pos = mapi(percentage, 0, 100, SERVO_LEFT_MIN, SERVO_LEFT_MAX);
-  const uint16_t right_pos = mapi(percentage, 0, 100, SERVO_RIGHT_MIN, SERVO_RIGHT_MAX);
-
-  handle.left_position = left_pos;
-  handle.right_position = right_pos;
+static bool leg_shaper_valid(const float frequency, const float damping) {
+  return std::isfinite(frequency) && frequency <= LEG_SHAPER_MAX_FREQUENCY
+         && std::isfinite(damping) && damping >= 0 && damping < 1;
+}
 
-  handle.left_position_percentage = percentage;
-  handle.right_position_percentage = percentage;
+static leg_shaper_t leg_shaper_load() {
+  leg_shaper_t shaper = { .frequency = LEG_SHAPER_FREQUENCY, .damping = LEG_SHAPER_DAMPING };
+  leg_shaper_t stored;
+  size_t length = sizeof(stored);
+  if (storage_load(LEG_SHAPER_NAMESPACE, LEG_SHAPER_KEY, &stored, &length) && length == sizeof(stored)
+      && leg_shaper_valid(stored.frequency, stored.damping)) {
+    shaper = stored;
+  }
+  return shaper;
+}
 
-  const int positions[2] = {
-    left_pos,
-    right_pos
-  };
+static void leg_shaper_configure(const leg_shaper_t shaper) {
+  // 运动中修改时整形器以当前输出为起点，腿不会跳变
+  taskENTER_CRITICAL(&scheduler.lock);
+  left_shaper.configure(InputShaper::ZV, shaper.frequency, shaper.damping);
+  right_shaper.configure(InputShaper::ZV, shaper.frequency, shaper.damping);
+  taskEXIT_CRITICAL(&scheduler.lock);
+  log_info("leg shaper: %.2fHz, damping %.2f, delay %.0fms", shaper.frequency, shaper.damping, left_shaper.delay() * 1000);
+}
 
-  const int speeds[2] = {
-    handle.left_speed,
-    handle.right_speed
-  };
+void robot_leg_set_shaper(const float frequency, const float damping) {
+  if (!leg_shaper_valid(frequency, damping)) {
+    log_warn("leg shaper rejected: %.2fHz, damping %.2f", frequency, damping);
+    return;
+  }
+  const leg_shaper_t shaper = { .frequency = frequency, .damping = damping };
+  leg_shaper_configure(shaper);
+  storage_save(LEG_SHAPER_NAMESPACE, LEG_SHAPER_KEY, &shaper, sizeof(shaper));
+}
 
-  servos.setTargetPositions(2, ID, positions, speeds);
+void robot_leg_set_height_percentage(uint8_t percentage) {
+  percentage = constrain(percentage, 0, 100);
+  leg_plan(percentage, percentage);
 }
 
 void robot_leg_set_left_height_percentage(uint8_t percentage) {
   percentage = constrain(percentage, 0, 100);
-
-  const uint16_t left_pos = mapi(percentage, 0, 100, SERVO_LEFT_MIN, SERVO_LEFT_MAX);
-  handle.left_position = left_pos;
-  handle.left_position_percentage = percentage;
-  servos.setTargetPosition(LEFT, left_pos);
+  leg_plan(percentage, -1);
 }
 
 void robot_leg_set_right_height_percentage(uint8_t percentage) {
   percentage = constrain(percentage, 0, 100);
-
-  const uint16_t right_pos = mapi(percentage, 0, 100, SERVO_RIGHT_MAX, SERVO_RIGHT_MIN);
-  handle.right_position = right_pos;
-  handle.right_position_percentage = percentage;
-  servos.setTargetPosition(RIGHT, right_pos);
+  leg_plan(-1, percentage);
 }
 
 uint8_t robot_leg_get_left_height_percentage() {
@@ -159,5 +599,9 @@ uint8_t robot_leg_get_right_height_percentage() {
 }
 
 uint8_t robot_leg_get_height_percentage() {
+  if (robot_leg_telemetry_t telemetry; telemetry_snapshot.load(telemetry)
+    && static_cast<uint32_t>(millis()) - telemetry.timestamp < LEG_TELEMETRY_TIMEOUT) {
+    return telemetry.height_percentage;
+  }
   return handle.right_position_percentage;
 }
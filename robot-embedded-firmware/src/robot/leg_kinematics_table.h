@@ -0,0 +1,64 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// 由 tools/leg_kinematics.py 生成，请勿手动修改
+
+#pragma once
+
+#define LEG_KINEMATICS_STEP_SHIFT 4
+#define LEG_KINEMATICS_TRAVEL_MAX 560
+#define LEG_KINEMATICS_SIZE 37
+#define LEG_KINEMATICS_MEASURED 0 // 几何参数已实测
+
+// { 轮轴高度(mm), 质心水平偏移(mm), 质心高度(mm), 零点俯仰角(°) }，索引为行程 / 16
+static const float leg_kinematics_table[LEG_KINEMATICS_SIZE][4] = {
+  { 56.609f, 5.909f, 76.942f, -4.3916f }, // 0
+  { 58.404f, 5.894f, 78.614f, -4.2876f }, // 16
+  { 60.232f, 5.877f, 80.319f, -4.1850f }, // 32
+  { 62.089f, 5.858f, 82.054f, -4.0837f }, // 48
+  { 63.974f, 5.837f, 83.815f, -3.9840f }, // 64
+  { 65.883f, 5.815f, 85.601f, -3.8860f }, // 80
+  { 67.814f, 5.790f, 87.408f, -3.7899f }, // 96
+  { 69.762f, 5.764f, 89.234f, -3.6956f }, // 112
+  { 71.725f, 5.735f, 91.075f, -3.6034f }, // 128
+  { 73.700f, 5.705f, 92.927f, -3.5132f }, // 144
+  { 75.684f, 5.673f, 94.789f, -3.4251f }, // 160
+  { 77.673f, 5.639f, 96.658f, -3.3391f }, // 176
+  { 79.665f, 5.604f, 98.529f, -3.2552f }, // 192
+  { 81.655f, 5.566f, 100.400f, -3.1734f }, // 208
+  { 83.642f, 5.527f, 102.269f, -3.0937f }, // 224
+  { 85.623f, 5.487f, 104.133f, -3.0160f }, // 240
+  { 87.594f, 5.444f, 105.988f, -2.9404f }, // 256
+  { 89.553f, 5.400f, 107.832f, -2.8668f }, // 272
+  { 91.496f, 5.354f, 109.663f, -2.7951f }, // 288
+  { 93.422f, 5.307f, 111.477f, -2.7253f }, // 304
+  { 95.328f, 5.258f, 113.273f, -2.6575f }, // 320
+  { 97.211f, 5.207f, 115.048f, -2.5914f }, // 336
+  { 99.069f, 5.155f, 116.800f, -2.5270f }, // 352
+  { 100.899f, 5.101f, 118.526f, -2.4644f }, // 368
+  { 102.699f, 5.046f, 120.224f, -2.4034f }, // 384
+  { 104.468f, 4.990f, 121.893f, -2.3441f }, // 400
+  { 106.202f, 4.932f, 123.529f, -2.2862f }, // 416
+  { 107.901f, 4.872f, 125.132f, -2.2299f }, // 432
+  { 109.561f, 4.812f, 126.700f, -2.1750f }, // 448
+  { 111.182f, 4.750f, 128.230f, -2.1214f }, // 464
+  { 112.761f, 4.687f, 129.721f, -2.0692f }, // 480
+  { 114.297f, 4.622f, 131.171f, -2.0183f }, // 496
+  { 115.787f, 4.557f, 132.579f, -1.9686f }, // 512
+  { 117.231f, 4.490f, 133.943f, -1.9201f }, // 528
+  { 118.627f, 4.423f, 135.261f, -1.8727f }, // 544
+  { 119.974f, 4.354f, 136.534f, -1.8264f }, // 560
+  { 121.270f, 4.284f, 137.758f, -1.7812f }, // 576
+};
@@ -0,0 +1,88 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#include "leg_trajectory.hpp"
+
+#include <cmath>
+
+// 静止起步的最小加加速度轨迹：峰值速度 = 1.875 D/T，峰值加速度 = 5.7735 D/T²
+#define MIN_JERK_PEAK_VELOCITY 1.875f
+#define MIN_JERK_PEAK_ACCELERATION 5.7735f
+
+MinJerkTrajectory::MinJerkTrajectory(const float max_velocity, const float max_acceleration, const float min_duration)
+  : max_velocity_(max_velocity), max_acceleration_(max_acceleration), min_duration_(min_duration) {
+  reset(0);
+}
+
+void MinJerkTrajectory::reset(const float position) {
+  coeff_[0] = position;
+  for (int i = 1; i < 6; i++) {
+    coeff_[i] = 0;
+  }
+  start_ = 0;
+  duration_ = 0;
+  target_ = position;
+  active_ = false;
+  position_ = position;
+  velocity_ = 0;
+  acceleration_ = 0;
+}
+
+void MinJerkTrajectory::retarget(const float target, const uint64_t now) {
+  sample(now);
+
+  const float h = target - position_;
+  const float distance = fabsf(h);
+  float T = min_duration_;
+  T = fmaxf(T, MIN_JERK_PEAK_VELOCITY * distance / max_velocity_);
+  T = fmaxf(T, sqrtf(MIN_JERK_PEAK_ACCELERATION * distance / max_acceleration_));
+
+  // 边界条件：起点 (p0, v0, a0)，终点 (target, 0, 0)
+  const float v0 = velocity_;
+  const float a0 = acceleration_;
+  const float T2 = T * T;
+  const float T3 = T2 * T;
+  coeff_[0] = position_;
+  coeff_[1] = v0;
+  coeff_[2] = a0 / 2;
+  coeff_[3] = (20 * h - 12 * v0 * T - 3 * a0 * T2) / (2 * T3);
+  coeff_[4] = (-30 * h + 16 * v0 * T + 3 * a0 * T2) / (2 * T3 * T);
+  coeff_[5] = (12 * h - 6 * v0 * T - a0 * T2) / (2 * T3 * T2);
+
+  start_ = now;
+  duration_ = T;
+  target_ = target;
+  active_ = true;
+}
+
+void MinJerkTrajectory::sample(const uint64_t now) {
+  if (!active_) {
+    return;
+  }
+
+  const float t = static_cast<float>(now - start_) / 1000000.0f;
+  if (t >= duration_) {
+    position_ = target_;
+    velocity_ = 0;
+    acceleration_ = 0;
+    active_ = false;
+    return;
+  }
+
+  const float* c = coeff_;
+  position_ = c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))));
+  velocity_ = c[1] + t * (2 * c[2] + t * (3 * c[3] + t * (4 * c[4] + t * 5 * c[5])));
+  acceleration_ = 2 * c[2] + t * (6 * c[3] + t * (12 * c[4] + t * 20 * c[5]));
+}
@@ -0,0 +1,83 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 最小加加速度（minimum-jerk）轨迹
+ *
+ * 五次多项式，从当前的位置/速度/加速度平滑过渡到目标点，终点速度和加速度为0。
+ * 运动中重新设定目标时以当前状态为起点，轨迹保持连续。
+ * 时长由距离、最大速度和最大加速度共同决定。
+ */
+class MinJerkTrajectory {
+public:
+  /**
+   * @param max_velocity 最大速度（单位/秒）
+   * @param max_acceleration 最大加速度（单位/秒²）
+   * @param min_duration 最短时长（秒）
+   */
+  MinJerkTrajectory(float max_velocity, float max_acceleration, float min_duration);
+
+  /** @brief 静止在指定位置 */
+  void reset(float position);
+
+  /**
+   * @brief 从当前状态出发规划到新目标
+   * @param target 目标位置
+   * @param now 当前时间（微秒）
+   */
+  void retarget(float target, uint64_t now);
+
+  /** @brief 采样 now（微秒）时刻的状态 */
+  void sample(uint64_t now);
+
+  bool active() const {
+    return active_;
+  }
+
+  float target() const {
+    return target_;
+  }
+
+  float position() const {
+    return position_;
+  }
+
+  float velocity() const {
+    return velocity_;
+  }
+
+  float acceleration() const {
+    return acceleration_;
+  }
+
+private:
+  float max_velocity_;
+  float max_acceleration_;
+  float min_duration_;
+
+  float coeff_[6]; // 位置多项式系数，coeff_[i] * t^i
+  uint64_t start_; // 起始时间（微秒）
+  float duration_; // 时长（秒）
+  float target_;
+  bool active_;
+
+  float position_;
+  float velocity_;
+  float acceleration_;
+};
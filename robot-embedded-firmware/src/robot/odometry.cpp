@@ -0,0 +1,106 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "robot/odometry.h"
+#include "robot/stats.h"
+
+#include "snapshot.hpp"
+#include "esp/misc.hpp"
+
+#include <atomic>
+#include <cmath>
+
+#define ODOMETRY_REPORT_INTERVAL 500 // 上报间隔，单位：毫秒
+
+static constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+static struct {
+  bool initialized;
+  int64_t left_origin;  // 归零时的计数
+  int64_t right_origin;
+  int64_t left_count;   // 上一周期的计数
+  int64_t right_count;
+  float heading_origin; // 归零时的航向
+  float heading;        // 上一周期的航向（相对）
+  double x;             // 位置用 double 累加，长时间运行也不丢失精度
+  double y;
+} state;
+
+static std::atomic<bool> reset_requested{ false };
+static Snapshot<robot_odometry_t> odometry_snapshot;
+
+void robot_odometry_init() {
+  stats_register_callback([](status_report_t* report, void*)-> bool {
+    robot_odometry_t pose;
+    if (!robot_odometry_get(&pose)) {
+      return false;
+    }
+    report->odometry = {
+      .x = pose.x,
+      .y = pose.y,
+      .heading = pose.heading,
+      .distance = pose.distance
+    };
+    return true;
+  }, status_odometry, nullptr, ODOMETRY_REPORT_INTERVAL);
+}
+
+void robot_odometry_update(const int64_t left_count, const int64_t right_count, const float meters_per_count, const float heading) {
+  if (!state.initialized || reset_requested.exchange(false)) {
+    state = {
+      .initialized = true,
+      .left_origin = left_count,
+      .right_origin = right_count,
+      .left_count = left_count,
+      .right_count = right_count,
+      .heading_origin = heading,
+      .heading = 0,
+      .x = 0,
+      .y = 0,
+    };
+  }
+
+  // 本周期的行程，按前后两次航向的中点方向积分
+  const int64_t delta = (left_count - state.left_count) + (right_count - state.right_count);
+  const double step = static_cast<double>(delta) * 0.5 * meters_per_count;
+  const float relative_heading = heading - state.heading_origin;
+  const double direction = 0.5 * (state.heading + relative_heading) * DEG_TO_RAD;
+  state.x += step * cos(direction);
+  state.y += step * sin(direction);
+  state.left_count = left_count;
+  state.right_count = right_count;
+  state.heading = relative_heading;
+
+  const int64_t left = left_count - state.left_origin;
+  const int64_t right = right_count - state.right_origin;
+  odometry_snapshot.publish({
+    .left_count = left,
+    .right_count = right,
+    .distance = static_cast<float>(static_cast<double>(left + right) * 0.5 * meters_per_count),
+    .x = static_cast<float>(state.x),
+    .y = static_cast<float>(state.y),
+    .heading = relative_heading,
+    .timestamp = static_cast<uint32_t>(millis()),
+  });
+}
+
+void robot_odometry_reset() {
+  reset_requested.store(true);
+}
+
+bool robot_odometry_get(robot_odometry_t* odometry) {
+  return odometry_snapshot.load(*odometry);
+}
@@ -0,0 +1,97 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "setpoint_shaper.hpp"
+
+#include <cmath>
+
+JerkLimitedRamp::JerkLimitedRamp(const float max_rate, const float max_jerk)
+  : max_rate_(max_rate), max_jerk_(max_jerk) {
+}
+
+void JerkLimitedRamp::reset(const float value) {
+  value_ = value;
+  rate_ = 0;
+}
+
+void JerkLimitedRamp::set_limits(const float max_rate, const float max_jerk) {
+  max_rate_ = max_rate;
+  max_jerk_ = max_jerk;
+}
+
+float JerkLimitedRamp::update(const float target, const float dt) {
+  const float error = target - value_;
+
+  // 期望变化率：远离目标时取上限，接近时按 r²/(2·j) = |e| 收回，刚好以最大加加速度在目标处停住。
+  // 按离散形式求解：本周期走过 (r + r')·dt/2 后，剩余距离仍要够 r' 刹停，否则变化率收得晚一步，落点会超调
+  const float max_step = max_jerk_ * dt;
+  const float ahead = error - 0.5f * rate_ * dt;
+  const float braking = sqrtf(0.25f * max_step * max_step + 2 * max_jerk_ * fabsf(ahead)) - 0.5f * max_step;
+  const float desired = copysignf(fminf(max_rate_, braking), ahead);
+  const float rate = rate_ + constrain(desired - rate_, -max_step, max_step);
+
+  const float value = value_ + 0.5f * (rate_ + rate) * dt;
+
+  // 本周期越过或到达目标，且剩余变化率一步之内就能收回：直接停在目标上，避免在目标附近来回抖动
+  if ((target - value) * error <= 0 && fabsf(rate) <= 2 * max_step) {
+    value_ = target;
+    rate_ = 0;
+  }
+  else {
+    value_ = value;
+    rate_ = rate;
+  }
+  return value_;
+}
+
+SetpointShaper::SetpointShaper(const float max_acceleration, const float max_jerk,
+  const float max_yaw_acceleration, const float max_yaw_jerk, const uint32_t hold_time)
+  : speed_(max_acceleration, max_jerk), yaw_rate_(max_yaw_acceleration, max_yaw_jerk), hold_time_(hold_time) {
+}
+
+void SetpointShaper::command(const float speed, const float yaw_rate, const uint64_t now) {
+  speed_command_.store(speed, std::memory_order_relaxed);
+  yaw_rate_command_.store(yaw_rate, std::memory_order_relaxed);
+  command_time_.store(static_cast<uint32_t>(now), std::memory_order_release);
+}
+
+void SetpointShaper::reset() {
+  reset_requested_.store(true);
+}
+
+void SetpointShaper::update(const float dt, const uint64_t now) {
+  if (reset_requested_.exchange(false)) {
+    speed_command_.store(0, std::memory_order_relaxed);
+    yaw_rate_command_.store(0, std::memory_order_relaxed);
+    speed_.reset(0);
+    yaw_rate_.reset(0);
+  }
+
+  // 短暂丢包时沿用最后一次指令；断开太久则按加减速限制停下
+  const uint32_t elapsed = static_cast<uint32_t>(now) - command_time_.load(std::memory_order_acquire);
+  timed_out_ = elapsed > hold_time_;
+  if (timed_out_) {
+    speed_target_ = 0;
+    yaw_rate_target_ = 0;
+  }
+  else {
+    speed_target_ = speed_command_.load(std::memory_order_relaxed);
+    yaw_rate_target_ = yaw_rate_command_.load(std::memory_order_relaxed);
+  }
+
+  speed_.update(speed_target_, dt);
+  yaw_rate_.update(yaw_rate_target_, dt);
+}
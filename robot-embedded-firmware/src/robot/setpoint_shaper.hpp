@@ -0,0 +1,159 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include <atomic>
+
+#include "defs.h"
+
+/**
+ * @brief 加加速度受限的斜坡
+ *
+ * 输出以有限的变化率（加速度）和变化率的变化率（加加速度）逼近目标值。
+ * 接近目标时加速度按 a = √(2·j·|e|) 收回，正好以最大加加速度把加速度降到0，落点不超调。
+ * 目标随时可变，输出及其变化率始终连续。
+ */
+class JerkLimitedRamp {
+public:
+  /**
+   * @param max_rate 最大变化率（单位/秒）
+   * @param max_jerk 最大加加速度（单位/秒²）
+   */
+  JerkLimitedRamp(float max_rate, float max_jerk);
+
+  /** @brief 输出立即停在指定值 */
+  void reset(float value);
+
+  /** @brief 修改限制，运行中也可以调用 */
+  void set_limits(float max_rate, float max_jerk);
+
+  /** @brief 向 target 推进 dt 秒 */
+  float update(float target, float dt);
+
+  float value() const {
+    return value_;
+  }
+
+  float rate() const {
+    return rate_;
+  }
+
+  /** @brief 是否已停在 target 上 */
+  bool settled(const float target) const {
+    return value_ == target && rate_ == 0;
+  }
+
+private:
+  float max_rate_;
+  float max_jerk_;
+  float value_ = 0;
+  float rate_ = 0;
+};
+
+/**
+ * @brief 摇杆指令整形
+ *
+ * 把遥控指令转换为平滑的线速度、偏航角速度参考值，加速度和加加速度都有上限，
+ * 起步、停车时不会突然要求大的前后倾角，从而不激起俯仰振荡。
+ *
+ * 蓝牙偶尔丢包时沿用最后一次指令，超过保持时间仍没有新指令才认为遥控断开，按限制减速到0。
+ * command() 可在任意任务中调用，update() 只在控制环中调用。
+ */
+class SetpointShaper {
+public:
+  /**
+   * @param max_acceleration 线加速度上限（m/s²）
+   * @param max_jerk 线加加速度上限（m/s³）
+   * @param max_yaw_acceleration 偏航角加速度上限（°/s²）
+   * @param max_yaw_jerk 偏航角加加速度上限（°/s³）
+   * @param hold_time 指令保持时间（毫秒）
+   */
+  SetpointShaper(float max_acceleration, float max_jerk, float max_yaw_acceleration, float max_yaw_jerk, uint32_t hold_time);
+
+  /**
+   * @brief 设置新的指令
+   * @param speed 线速度（m/s），正数前进
+   * @param yaw_rate 偏航角速度（°/s）
+   * @param now 当前时间（毫秒）
+   */
+  void command(float speed, float yaw_rate, uint64_t now);
+
+  /** @brief 清除指令，参考值立即归零 */
+  void reset();
+
+  /**
+   * @brief 推进一个控制周期
+   * @param dt 周期（秒）
+   * @param now 当前时间（毫秒）
+   */
+  void update(float dt, uint64_t now);
+
+  /** @brief 线速度参考值（m/s） */
+  float speed() const {
+    return speed_.value();
+  }
+
+  /** @brief 线加速度参考值（m/s²） */
+  float acceleration() const {
+    return speed_.rate();
+  }
+
+  /** @brief 偏航角速度参考值（°/s） */
+  float yaw_rate() const {
+    return yaw_rate_.value();
+  }
+
+  /** @brief 当前生效的线速度指令（m/s），超时后为0 */
+  float speed_target() const {
+    return speed_target_;
+  }
+
+  /** @brief 当前生效的偏航角速度指令（°/s），超时后为0 */
+  float yaw_rate_target() const {
+    return yaw_rate_target_;
+  }
+
+  /** @brief 是否有前进后退指令或仍在加减速 */
+  bool driving() const {
+    return !speed_.settled(0) || speed_target_ != 0;
+  }
+
+  /** @brief 是否有转向指令或仍在加减速 */
+  bool turning() const {
+    return !yaw_rate_.settled(0) || yaw_rate_target_ != 0;
+  }
+
+  /** @brief 指令是否因超时被清零 */
+  bool timed_out() const {
+    return timed_out_;
+  }
+
+private:
+  JerkLimitedRamp speed_;
+  JerkLimitedRamp yaw_rate_;
+  uint32_t hold_time_;
+
+  // 指令由通信任务写入、控制环读取
+  std::atomic<float> speed_command_{ 0 };
+  std::atomic<float> yaw_rate_command_{ 0 };
+  std::atomic<uint32_t> command_time_{ 0 };
+  std::atomic<bool> reset_requested_{ false };
+
+  float speed_target_ = 0;
+  float yaw_rate_target_ = 0;
+  bool timed_out_ = false;
+};
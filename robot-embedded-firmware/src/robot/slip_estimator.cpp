@@ -0,0 +1,83 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "slip_estimator.hpp"
+
+#include <cmath>
+
+#define GRAVITY 9.81f
+#define DEG_TO_RAD 0.0174532925f
+
+#define SLIP_ACCELERATION 3.0f      // 轮部与车身加速度之差超过该值视为纵向打滑，单位：m/s²
+#define SLIP_YAW_RATE 60.0f         // 轮速与陀螺仪偏航角速度之差超过该值视为单边打滑，单位：°/s
+#define SLIP_HOLD_TICKS 40          // 最后一次打滑证据后保持的周期数（5ms 周期约 200ms）
+#define ACCELERATION_TF 0.02f       // 车身加速度、俯仰角加速度的低通时间常数，与轮部加速度一致，单位：秒
+#define SPEED_CORRECTION_TF 0.05f   // 不打滑时车身速度向轮速收敛的时间常数，单位：秒
+#define BIAS_TF 2.0f                // 加速度计零偏学习的时间常数，单位：秒
+
+void SlipEstimator::reset() {
+  initialized_ = false;
+  speed_ = 0;
+  body_acceleration_ = 0;
+  pitch_rate_ = 0;
+  pitch_acceleration_ = 0;
+  hold_ = 0;
+}
+
+void SlipEstimator::update(const float dt, const float wheel_speed, const float wheel_acceleration, const float specific_force,
+  const float pitch, const float pitch_rate, const float lever, const float wheel_yaw_rate, const float gyro_yaw_rate, const bool grounded) {
+  if (!initialized_ || dt <= 0) {
+    speed_ = wheel_speed;
+    pitch_rate_ = pitch_rate;
+    initialized_ = true;
+    return;
+  }
+
+  // 俯仰角加速度：车身绕轮轴转动时，加速度计处的切向加速度与轮轴平移无关
+  const float alpha = dt / (ACCELERATION_TF + dt);
+  pitch_acceleration_ += alpha * ((pitch_rate - pitch_rate_) / dt - pitch_acceleration_);
+  pitch_rate_ = pitch_rate;
+
+  // 加速度计读数 = 轮轴加速度 - 重力分量 + 杠杆项；向前倒时重力分量使读数为负
+  const float raw = (specific_force + sinf(pitch * DEG_TO_RAD)) * GRAVITY
+                    - lever * pitch_acceleration_ * DEG_TO_RAD * cosf(pitch * DEG_TO_RAD) - bias_;
+  body_acceleration_ += alpha * (raw - body_acceleration_);
+
+  if (!grounded) {
+    speed_ = wheel_speed;
+    hold_ = 0;
+    return;
+  }
+
+  // 轮子比车身加速（或减速）得更猛才算打滑，反过来多半是加速度计的噪声
+  const float excess = fabsf(wheel_acceleration) - fabsf(body_acceleration_);
+  const bool longitudinal = excess > SLIP_ACCELERATION && fabsf(wheel_acceleration - body_acceleration_) > SLIP_ACCELERATION;
+  const bool differential = fabsf(wheel_yaw_rate - gyro_yaw_rate) > SLIP_YAW_RATE;
+  if (longitudinal || differential) {
+    hold_ = SLIP_HOLD_TICKS;
+    count_++;
+  }
+  else if (hold_ > 0) {
+    hold_--;
+  }
+
+  speed_ += body_acceleration_ * dt;
+  if (!slipping()) {
+    // 轮速可信：速度向轮速收敛，两者之差的长期趋势归入零偏
+    speed_ += (wheel_speed - speed_) * dt / (SPEED_CORRECTION_TF + dt);
+    bias_ += (body_acceleration_ - wheel_acceleration) * dt / (BIAS_TF + dt);
+  }
+}
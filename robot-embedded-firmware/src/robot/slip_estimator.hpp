@@ -0,0 +1,84 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 轮子打滑检测与车身速度融合
+ *
+ * 每个控制周期比较两组信号：
+ * - 轮部线加速度与车身纵向加速度：加速度计读数扣除重力分量、扣除俯仰角加速度带来的杠杆项，
+ *   轮子明显比车身加速得快（空转）或减速得快（抱死）即为纵向打滑；
+ * - 左右轮差速换算的偏航角速度与陀螺仪：单边打滑时两者对不上。
+ * 有证据后保持一段时间才撤销。
+ *
+ * 车身速度由加速度计积分得到，不打滑时以轮速为准快速校正，同时学习加速度计零偏；
+ * 打滑时只积分加速度计，短时间内仍能给速度环提供可信的反馈。
+ */
+class SlipEstimator {
+public:
+  SlipEstimator() = default;
+
+  /** @brief 清空状态，车身速度从轮速重新开始 */
+  void reset();
+
+  /**
+   * @brief 更新一个控制周期
+   * @param dt 周期（秒）
+   * @param wheel_speed 轮部线速度（m/s），前进为正
+   * @param wheel_acceleration 轮部线加速度（m/s²）
+   * @param specific_force 加速度计前后方向读数（g）
+   * @param pitch 俯仰角（°），向前倒为正
+   * @param pitch_rate 俯仰角速度（°/s）
+   * @param lever 加速度计到轮轴的距离（米）
+   * @param wheel_yaw_rate 左右轮差速换算的偏航角速度（°/s）
+   * @param gyro_yaw_rate 扣除零偏的陀螺仪偏航角速度（°/s）
+   * @param grounded 是否着地，离地时不判断打滑
+   */
+  void update(float dt, float wheel_speed, float wheel_acceleration, float specific_force, float pitch,
+    float pitch_rate, float lever, float wheel_yaw_rate, float gyro_yaw_rate, bool grounded);
+
+  bool slipping() const {
+    return hold_ > 0;
+  }
+
+  /** @brief 融合后的车身速度（m/s） */
+  float speed() const {
+    return speed_;
+  }
+
+  /** @brief 扣除重力、零偏后的车身纵向加速度（m/s²） */
+  float body_acceleration() const {
+    return body_acceleration_;
+  }
+
+  /** @brief 累计检测到打滑的周期数 */
+  uint32_t count() const {
+    return count_;
+  }
+
+private:
+  bool initialized_ = false;
+  float speed_ = 0;
+  float body_acceleration_ = 0;
+  float bias_ = 0; // 加速度计零偏（含安装角），单位：m/s²
+  float pitch_rate_ = 0;
+  float pitch_acceleration_ = 0;
+  uint16_t hold_ = 0;
+  uint32_t count_ = 0;
+};
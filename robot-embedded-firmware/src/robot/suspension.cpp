@@ -0,0 +1,131 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#include "robot/suspension.h"
+
+#include <cmath>
+
+#include "attitude_sensor.h"
+#include "logging.hpp"
+#include "robot/leg.h"
+#include "esp/storage.hpp"
+#include "foc/common/lowpass_filter.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static auto TAG = "suspension";
+
+// 开关状态保存在 NVS 中，重启后保持
+#define SUSPENSION_NAMESPACE "robot"
+#define SUSPENSION_KEY "suspension"
+
+#define SUSPENSION_CORE 0     // 与平衡环(core 1)错开
+#define SUSPENSION_INTERVAL 10 // 单位：毫秒
+
+// 虚拟弹簧阻尼：固有频率约 3Hz，阻尼比约 0.7
+#define SUSPENSION_SPRING 355.0f
+#define SUSPENSION_DAMPING 26.0f
+
+#define SUSPENSION_ACCEL_GAIN 1800.0f // 竖直加速度（g）到虚拟力，1g 冲击约压缩 5%
+#define SUSPENSION_LOAD_GAIN 10.0f    // 舵机负载（0.1%）到虚拟力，负载上升 10% 约压缩 3%
+#define SUSPENSION_TRAVEL 10.0f       // 最大压缩/伸长，单位：%
+
+static struct {
+  volatile bool enabled;
+  TaskHandle_t task;
+
+  float offset;   // 当前高度偏移，单位：%，负数为压缩
+  float velocity; // 偏移速度，单位：%/s
+} suspension = {
+  .enabled = false,
+  .task = nullptr,
+  .offset = 0,
+  .velocity = 0,
+};
+
+// 静态分量（重力、站立时的负载）由低通滤波得到，只对变化量做出响应
+static LowPassFilter lpf_accel(0.5);
+static LowPassFilter lpf_load(0.5);
+
+static float suspension_load() {
+  robot_leg_telemetry_t telemetry;
+  if (!robot_leg_get_telemetry(&telemetry)) {
+    return 0;
+  }
+  return (std::abs(telemetry.left.load) + std::abs(telemetry.right.load)) / 2.0f;
+}
+
+[[noreturn]]
+static void suspension_task(void*) {
+  constexpr float dt = SUSPENSION_INTERVAL / 1000.0f;
+
+  TickType_t last_wake_time = xTaskGetTickCount();
+  for (;;) {
+    if (!suspension.enabled) {
+      suspension.offset = 0;
+      suspension.velocity = 0;
+      robot_leg_set_height_offset(leg_offset_suspension, 0, 0);
+
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      last_wake_time = xTaskGetTickCount();
+      continue;
+    }
+    vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(SUSPENSION_INTERVAL));
+
+    // 车身被向上顶（加速度增大）或腿部受力增大时，腿部收缩让出行程
+    const float accel = attitude_get_acceleration()->z;
+    const float load = suspension_load();
+    const float force = -SUSPENSION_ACCEL_GAIN * (accel - lpf_accel(accel))
+                        - SUSPENSION_LOAD_GAIN * (load - lpf_load(load));
+
+    suspension.velocity += (force - SUSPENSION_SPRING * suspension.offset - SUSPENSION_DAMPING * suspension.velocity) * dt;
+    suspension.offset += suspension.velocity * dt;
+    if (fabsf(suspension.offset) > SUSPENSION_TRAVEL) {
+      suspension.offset = constrain(suspension.offset, -SUSPENSION_TRAVEL, SUSPENSION_TRAVEL);
+      suspension.velocity = 0;
+    }
+
+    // 只更新目标，由腿部调度任务合并下发，这里不会阻塞在总线上
+    robot_leg_set_height_offset(leg_offset_suspension, suspension.offset, suspension.offset);
+  }
+}
+
+void robot_suspension_init() {
+  uint8_t enabled = 0;
+  size_t length = sizeof(enabled);
+  if (storage_load(SUSPENSION_NAMESPACE, SUSPENSION_KEY, &enabled, &length) && length == sizeof(enabled)) {
+    suspension.enabled = enabled != 0;
+    log_info("active suspension %s", suspension.enabled ? "enabled" : "disabled");
+  }
+  xTaskCreatePinnedToCore(suspension_task, "suspension", 3072, nullptr, 7, &suspension.task, SUSPENSION_CORE);
+}
+
+void robot_suspension_set_enabled(const bool enabled) {
+  if (suspension.enabled == enabled) {
+    return;
+  }
+  log_info("active suspension %s", enabled ? "enabled" : "disabled");
+  suspension.enabled = enabled;
+  const uint8_t value = enabled;
+  storage_save(SUSPENSION_NAMESPACE, SUSPENSION_KEY, &value, sizeof(value));
+  if (suspension.task) {
+    xTaskNotifyGive(suspension.task);
+  }
+}
+
+bool robot_suspension_is_enabled() {
+  return suspension.enabled;
+}
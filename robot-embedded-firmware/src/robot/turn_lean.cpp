@@ -0,0 +1,73 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#include "turn_lean.hpp"
+#include "robot/leg.h"
+
+#include <cmath>
+
+#define GRAVITY 9.81f
+#define RAD_TO_DEG 57.2957795f
+#define DEG_TO_RAD 0.0174532925f
+
+// 侧翻极限的安全系数，只使用不侧倾时极限角的一部分
+#define TIP_MARGIN 0.6f
+
+TurnLean::TurnLean(const float track, const float time_constant)
+  : track_(track), time_constant_(time_constant) {
+}
+
+void TurnLean::reset() {
+  lean_ = 0;
+  leg_offset_ = 0;
+  pitch_bias_ = 0;
+}
+
+void TurnLean::update(const float dt, const float speed, const float yaw_rate, const float height, const bool enabled) {
+  robot_leg_kinematics_t kinematics;
+  robot_leg_kinematics_lookup(height, &kinematics);
+
+  // 腿高每变化 1% 髋关节升降的高度（mm），由查找表在当前腿高处求斜率
+  robot_leg_kinematics_t upper, lower;
+  robot_leg_kinematics_lookup(fminf(height + 1, 100), &upper);
+  robot_leg_kinematics_lookup(fmaxf(height - 1, 0), &lower);
+  const float span = fminf(height + 1, 100) - fmaxf(height - 1, 0);
+  const float mm_per_percent = span > 0 ? fabsf(upper.height - lower.height) / span : 0;
+
+  // 侧倾角上限：腿离上下限的余量
+  const float half_track_mm = track_ * 500.0f;
+  const float reach = fminf(height, 100 - height) * mm_per_percent;
+  const float max_lean = atanf(reach / half_track_mm);
+
+  // 最大向心加速度：不侧倾时的侧翻极限（留余量）再加上能侧倾的角度
+  const float tip_angle = atanf(half_track_mm / fmaxf(kinematics.com_height, 1.0f));
+  max_lateral_acceleration_ = GRAVITY * tanf(TIP_MARGIN * tip_angle + max_lean);
+
+  float target = 0;
+  if (enabled) {
+    const float lateral_acceleration = speed * yaw_rate * DEG_TO_RAD;
+    target = constrain(atanf(lateral_acceleration / GRAVITY), -max_lean, max_lean) * RAD_TO_DEG;
+  }
+  lean_ += (target - lean_) * dt / (time_constant_ + dt);
+
+  const float offset = mm_per_percent > 0 ? half_track_mm * tanf(lean_ * DEG_TO_RAD) / mm_per_percent : 0;
+  leg_offset_ = offset;
+
+  robot_leg_kinematics_t left, right;
+  robot_leg_kinematics_lookup(constrain(height + offset, 0, 100), &left);
+  robot_leg_kinematics_lookup(constrain(height - offset, 0, 100), &right);
+  pitch_bias_ = (left.pitch_offset + right.pitch_offset) / 2 - kinematics.pitch_offset;
+}
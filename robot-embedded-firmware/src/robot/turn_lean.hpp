@@ -0,0 +1,80 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+
+#pragma once
+
+#include "defs.h"
+
+/**
+ * @brief 转弯侧倾前馈
+ *
+ * 边走边转时向心加速度 a = v·ω 指向弯内，在加速度计看来和车身向外侧倾斜一样。
+ * 横滚环要等倾角出现后才逐步调整腿高差，这里按实测的前进速度和偏航角速度提前算出
+ * 让合力穿过两轮中间所需的侧倾角，直接换算成左右腿高差叠加上去。
+ *
+ * 侧倾角受腿的行程限制（当前腿高离上下限的余量），弯中允许的最大向心加速度也随之确定：
+ * 车身不侧倾时合力偏出轮距一半即侧翻，侧倾后还能再多承受侧倾角对应的部分。
+ */
+class TurnLean {
+public:
+  /**
+   * @param track 轮距（米）
+   * @param time_constant 前馈的低通时间常数（秒），滤掉速度、角速度的测量噪声
+   */
+  TurnLean(float track, float time_constant);
+
+  /** @brief 清零 */
+  void reset();
+
+  /**
+   * @brief 更新前馈
+   * @param dt 周期（秒）
+   * @param speed 前进速度（m/s）
+   * @param yaw_rate 偏航角速度（°/s），与陀螺仪 Z 轴同向
+   * @param height 腿高（%）
+   * @param enabled 为 false 时前馈逐渐回到0（跳跃、离地）
+   */
+  void update(float dt, float speed, float yaw_rate, float height, bool enabled);
+
+  /** @brief 目标侧倾角（°），与横滚角同向 */
+  float lean() const {
+    return lean_;
+  }
+
+  /** @brief 左腿增加、右腿减少的腿高（%），与横滚环的 roll_offset 同向 */
+  float leg_offset() const {
+    return leg_offset_;
+  }
+
+  /** @brief 左右腿高不同带来的俯仰零点变化（°），腿长-质心关系非线性，两侧平均后不等于中间腿高的值 */
+  float pitch_bias() const {
+    return pitch_bias_;
+  }
+
+  /** @brief 当前腿高下不侧翻允许的最大向心加速度（m/s²） */
+  float max_lateral_acceleration() const {
+    return max_lateral_acceleration_;
+  }
+
+private:
+  float track_;
+  float time_constant_;
+
+  float lean_ = 0;
+  float leg_offset_ = 0;
+  float pitch_bias_ = 0;
+  float max_lateral_acceleration_ = 0;
+};
@@ -0,0 +1,251 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// BalanceEstimator replay: feeds a sensor log through the estimator, compares
+// the noise of the estimated state with the raw measurements and reports the
+// cost of one update.
+//
+//   balance_estimator_replay            synthetic log with known truth
+//   balance_estimator_replay log.csv    recorded log
+//
+// A log is CSV with the header
+//   dt,accel_pitch,gyro,distance[,pitch,pitch_rate,speed]
+// in s, °, °/s, rad; the optional trailing columns are the true state and
+// enable the error comparison. The exit code is non-zero if the estimate is
+// noisier than the raw signals it replaces (beyond a 1% margin).
+
+#include "robot/balance_estimator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+
+struct Sample {
+  float dt;
+  float accel_pitch;
+  float gyro;
+  float distance;
+  float pitch;
+  float pitch_rate;
+  float speed;
+};
+
+struct Log {
+  std::vector<Sample> samples;
+  bool has_truth = false;
+};
+
+/// 5 ms balance loop: wobbling pitch, wheels chasing it, accelerometer
+/// disturbed by the wheel acceleration, AS5600-quantized encoders.
+static Log synthetic_log() {
+  constexpr float DT = 0.005f;
+  constexpr float WHEEL_RADIUS = 0.034f;
+  constexpr float GRAVITY = 9.81f;
+  constexpr float RAD_TO_DEG = 57.2957795f;
+  constexpr float COUNT = 2 * static_cast<float>(M_PI) / 4096;
+
+  std::mt19937 rng(38);
+  std::normal_distribution<float> accel_noise(0.0f, 1.0f);
+  std::normal_distribution<float> gyro_noise(0.0f, 0.5f);
+
+  Log log;
+  log.has_truth = true;
+  for (int i = 0; i < 12000; i++) {
+    const float t = i * DT;
+    const float pitch = 2.0f * sinf(2 * M_PI * 1.3f * t) + 0.8f * sinf(2 * M_PI * 3.1f * t);
+    const float pitch_rate = 2.0f * 2 * M_PI * 1.3f * cosf(2 * M_PI * 1.3f * t)
+      + 0.8f * 2 * M_PI * 3.1f * cosf(2 * M_PI * 3.1f * t);
+    const float distance = 4.0f * sinf(2 * M_PI * 0.2f * t) + 0.6f * sinf(2 * M_PI * 1.3f * t);
+    const float speed = 4.0f * 2 * M_PI * 0.2f * cosf(2 * M_PI * 0.2f * t)
+      + 0.6f * 2 * M_PI * 1.3f * cosf(2 * M_PI * 1.3f * t);
+    const float wheel_acceleration = -4.0f * powf(2 * M_PI * 0.2f, 2) * sinf(2 * M_PI * 0.2f * t)
+      - 0.6f * powf(2 * M_PI * 1.3f, 2) * sinf(2 * M_PI * 1.3f * t);
+
+    Sample s{};
+    s.dt = DT;
+    s.accel_pitch = pitch + atanf(wheel_acceleration * WHEEL_RADIUS / GRAVITY) * RAD_TO_DEG + accel_noise(rng);
+    s.gyro = pitch_rate + gyro_noise(rng);
+    s.distance = roundf(distance / COUNT) * COUNT;
+    s.pitch = pitch;
+    s.pitch_rate = pitch_rate;
+    s.speed = speed;
+    log.samples.push_back(s);
+  }
+  return log;
+}
+
+static bool read_log(const char* path, Log& log) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+  char line[256];
+  if (fgets(line, sizeof(line), file) == nullptr) {
+    fclose(file);
+    return false;
+  }
+  log.has_truth = strstr(line, "pitch_rate") != nullptr;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    Sample s{};
+    const int fields = sscanf(line, "%f,%f,%f,%f,%f,%f,%f", &s.dt, &s.accel_pitch, &s.gyro, &s.distance,
+      &s.pitch, &s.pitch_rate, &s.speed);
+    if (fields < 4) {
+      continue;
+    }
+    log.has_truth &= fields == 7;
+    log.samples.push_back(s);
+  }
+  fclose(file);
+  return !log.samples.empty();
+}
+
+/// RMS of the tick-to-tick change: white measurement noise shows up here,
+/// the slow motion of the robot mostly does not.
+struct Jitter {
+  double sum = 0;
+  int count = 0;
+  float last = NAN;
+
+  void add(const float v) {
+    if (!std::isnan(last)) {
+      sum += (v - last) * (v - last);
+      count++;
+    }
+    last = v;
+  }
+
+  double rms() const {
+    return count > 0 ? sqrt(sum / count) : 0;
+  }
+};
+
+struct Error {
+  double sum = 0;
+  int count = 0;
+
+  void add(const float v, const float truth) {
+    sum += (v - truth) * (v - truth);
+    count++;
+  }
+
+  double rms() const {
+    return count > 0 ? sqrt(sum / count) : 0;
+  }
+};
+
+static bool compare(const Log& log) {
+  BalanceEstimator estimator;
+  Jitter raw_jitter[3], estimate_jitter[3];
+  Error raw_error[3], estimate_error[3];
+
+  float last_distance = NAN;
+  // the first second lets the covariance settle
+  const size_t settle = static_cast<size_t>(1.0f / log.samples.front().dt);
+  for (size_t i = 0; i < log.samples.size(); i++) {
+    const Sample& s = log.samples[i];
+    estimator.update(s.dt, s.accel_pitch, s.gyro, s.distance);
+    // without the filter the speed was a difference of encoder readings
+    const float raw_speed = std::isnan(last_distance) ? 0.0f : (s.distance - last_distance) / s.dt;
+    last_distance = s.distance;
+    if (i < settle) {
+      continue;
+    }
+
+    const float raw[3] = { s.accel_pitch, s.gyro, raw_speed };
+    const float estimate[3] = { estimator.pitch(), estimator.pitch_rate(), estimator.speed() };
+    const float truth[3] = { s.pitch, s.pitch_rate, s.speed };
+    for (int k = 0; k < 3; k++) {
+      raw_jitter[k].add(raw[k]);
+      estimate_jitter[k].add(estimate[k]);
+      if (log.has_truth) {
+        raw_error[k].add(raw[k], truth[k]);
+        estimate_error[k].add(estimate[k], truth[k]);
+      }
+    }
+  }
+
+  // the gyro is trusted almost as is, its estimate may only match the raw rate
+  constexpr double NOISE_MARGIN = 1.01;
+  static constexpr const char* names[3] = { "pitch (deg)", "pitch rate (deg/s)", "speed (rad/s)" };
+  bool better = true;
+  printf("%-20s %12s %12s", "", "raw jitter", "est jitter");
+  if (log.has_truth) {
+    printf(" %12s %12s", "raw error", "est error");
+  }
+  printf("\n");
+  for (int k = 0; k < 3; k++) {
+    printf("%-20s %12.4f %12.4f", names[k], raw_jitter[k].rms(), estimate_jitter[k].rms());
+    better &= estimate_jitter[k].rms() <= raw_jitter[k].rms() * NOISE_MARGIN;
+    if (log.has_truth) {
+      printf(" %12.4f %12.4f", raw_error[k].rms(), estimate_error[k].rms());
+      better &= estimate_error[k].rms() <= raw_error[k].rms() * NOISE_MARGIN;
+    }
+    printf("\n");
+  }
+  return better;
+}
+
+static void benchmark(const Log& log) {
+  constexpr int UPDATES = 200000;
+  BalanceEstimator estimator;
+  float sink = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+#ifdef HAVE_RDTSC
+  const unsigned long long cycles_start = __rdtsc();
+#endif
+  for (int i = 0; i < UPDATES; i++) {
+    const Sample& s = log.samples[i % log.samples.size()];
+    estimator.update(s.dt, s.accel_pitch, s.gyro, s.distance);
+    sink += estimator.pitch();
+  }
+#ifdef HAVE_RDTSC
+  const unsigned long long cycles = __rdtsc() - cycles_start;
+#endif
+  const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+  printf("update: %.1f ns", elapsed.count() / UPDATES);
+#ifdef HAVE_RDTSC
+  printf(", %.0f TSC cycles", static_cast<double>(cycles) / UPDATES);
+#endif
+  printf(" (checksum %g)\n", sink);
+}
+
+int main(const int argc, char** argv) {
+  Log log;
+  if (argc > 1) {
+    if (!read_log(argv[1], log)) {
+      fprintf(stderr, "%s: no samples\n", argv[1]);
+      return 2;
+    }
+  }
+  else {
+    log = synthetic_log();
+  }
+
+  printf("%zu samples%s\n", log.samples.size(), log.has_truth ? ", with true state" : "");
+  const bool better = compare(log);
+  benchmark(log);
+  return better ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// ContactEstimator on a free wheel model: lift-off, a wheel that settles at
+// its no-load speed, gentle set-down and landing impact.
+
+#include "robot/contact_estimator.hpp"
+
+#include "test.hpp"
+
+static constexpr float DT = 0.005f;
+static constexpr float NO_LOAD_SPEED = 12.5f;  // (rad/s)/V, see jump_mpc.py BACK_EMF
+static constexpr float TIME_CONSTANT = 0.022f; // s, wheel inertia against back-EMF
+
+/// Lifted wheel: first-order spin-up towards the no-load speed.
+static float free_wheel(const float speed, const float effort) {
+  return speed + (NO_LOAD_SPEED * effort - speed) * DT / TIME_CONSTANT;
+}
+
+static void lift(ContactEstimator& contact, float& speed, const float effort) {
+  for (int i = 0; i < 100 && contact.grounded(); i++) {
+    speed = free_wheel(speed, effort);
+    contact.update(DT, 0.2f, speed, effort);
+  }
+}
+
+TEST(stays_grounded_while_balancing) {
+  ContactEstimator contact;
+  for (int i = 0; i < 400; i++) {
+    contact.update(DT, 1.0f, 0.5f * (i % 2), 2.0f);
+    EXPECT(contact.grounded());
+  }
+}
+
+TEST(free_fall_lifts_off) {
+  ContactEstimator contact;
+  float speed = 0;
+  lift(contact, speed, 1.0f);
+  EXPECT(!contact.grounded());
+}
+
+TEST(wheel_at_no_load_speed_is_not_loaded) {
+  ContactEstimator contact;
+  float speed = 0;
+  lift(contact, speed, 2.0f);
+  EXPECT(!contact.grounded());
+
+  // held in the hand: 1 g, the wheel settles at its no-load speed and stops accelerating
+  for (int i = 0; i < 400; i++) {
+    speed = free_wheel(speed, 2.0f);
+    contact.update(DT, 1.0f, speed, 2.0f);
+    EXPECT(!contact.grounded());
+  }
+}
+
+TEST(gentle_set_down_with_stalled_wheel_lands) {
+  ContactEstimator contact;
+  float speed = 0;
+  lift(contact, speed, 2.0f);
+  EXPECT(!contact.grounded());
+
+  // on the ground the wheel turns far slower than the effort would spin it free
+  bool landed = false;
+  for (int i = 0; i < 10; i++) {
+    contact.update(DT, 1.0f, 0.3f, 2.0f);
+    landed |= contact.landed();
+  }
+  EXPECT(landed);
+  EXPECT(contact.grounded());
+}
+
+TEST(gentle_set_down_of_spinning_wheel_lands) {
+  ContactEstimator contact;
+  float speed = 0;
+  lift(contact, speed, 2.0f);
+  for (int i = 0; i < 200; i++) {
+    speed = free_wheel(speed, 2.0f);
+    contact.update(DT, 1.0f, speed, 2.0f);
+  }
+  EXPECT(!contact.grounded());
+
+  // the ground brakes the wheel against the effort
+  for (int i = 0; i < 10; i++) {
+    speed *= 0.8f;
+    contact.update(DT, 1.0f, speed, 2.0f);
+  }
+  EXPECT(contact.grounded());
+}
+
+TEST(no_effort_waits_for_impact) {
+  ContactEstimator contact;
+  float speed = 0;
+  lift(contact, speed, 1.0f);
+  for (int i = 0; i < 100; i++) {
+    contact.update(DT, 1.0f, 0.0f, 0.0f);
+  }
+  EXPECT(!contact.grounded());
+
+  contact.update(DT, 2.5f, 0.0f, 0.0f);
+  EXPECT(contact.landed());
+}
+
+TEST_MAIN()
@@ -0,0 +1,45 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// Differential drive sign: a wheel-speed command that makes the right
+// wheel faster must leave the right motor faster, i.e. it maps to a turn
+// in the same direction as the joystick and the motor mixing.
+
+#include "robot/differential_drive.hpp"
+
+#include "test.hpp"
+
+static constexpr float TRACK = 0.150f;
+
+TEST(right_faster_stays_right_faster) {
+  const float yaw_rate = differential_drive::yaw_rate(0.2f, 0.4f, TRACK);
+  // yaw loop output has the sign of its command
+  const float yaw = 0.04f * yaw_rate;
+  const float forward = 0.5f;
+  EXPECT(differential_drive::right(forward, yaw) > differential_drive::left(forward, yaw));
+}
+
+TEST(left_faster_is_right_turn) {
+  EXPECT(differential_drive::yaw_rate(0.4f, 0.2f, TRACK) > 0);
+  EXPECT(differential_drive::left(0.0f, 1.0f) > differential_drive::right(0.0f, 1.0f));
+}
+
+TEST(yaw_rate_from_wheel_speeds) {
+  // spin in place, wheels at ±0.1 m/s: ω = 0.2 / 0.15 rad/s
+  EXPECT_NEAR(differential_drive::yaw_rate(0.1f, -0.1f, TRACK), 0.2f / TRACK * 57.2957795f, 1e-3f);
+  EXPECT_NEAR(differential_drive::yaw_rate(0.3f, 0.3f, TRACK), 0.0f, 1e-6f);
+}
+
+TEST_MAIN()
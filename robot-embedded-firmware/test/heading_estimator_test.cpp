@@ -0,0 +1,52 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// HeadingEstimator: gyro bias is learned at rest and not from the
+// odometry error of a turn.
+
+#include "robot/heading_estimator.hpp"
+
+#include "test.hpp"
+
+static constexpr float DT = 0.005f;
+
+TEST(learns_bias_at_rest) {
+  HeadingEstimator heading;
+  for (int i = 0; i < 6000; i++) {
+    heading.update(DT, 1.5f, 0.0f, true);
+  }
+  EXPECT_NEAR(heading.gyro_bias(), 1.5f, 0.05f);
+  EXPECT_NEAR(heading.rate(), 0.0f, 0.05f);
+}
+
+TEST(turn_does_not_teach_odometry_error) {
+  HeadingEstimator heading;
+  // 90°/s turn, odometry reads 10% low (track width, tyre scrub)
+  for (int i = 0; i < 6000; i++) {
+    heading.update(DT, 90.0f, 81.0f, true);
+  }
+  EXPECT_NEAR(heading.gyro_bias(), 0.0f, 1e-6f);
+  EXPECT_NEAR(heading.heading(), 90.0f * 6000 * DT, 0.5f);
+}
+
+TEST(invalid_odometry_is_ignored) {
+  HeadingEstimator heading;
+  for (int i = 0; i < 6000; i++) {
+    heading.update(DT, 1.5f, 0.0f, false);
+  }
+  EXPECT_NEAR(heading.gyro_bias(), 0.0f, 1e-6f);
+}
+
+TEST_MAIN()
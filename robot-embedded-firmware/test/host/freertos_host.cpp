@@ -0,0 +1,149 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct HostTask {
+  std::mutex mutex;
+  std::condition_variable changed;
+  uint32_t notifications = 0;
+};
+
+struct HostQueue {
+  std::mutex mutex;
+  std::condition_variable changed;
+  size_t length;
+  size_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+static thread_local HostTask* current_task = nullptr;
+
+static const auto start_time = std::chrono::steady_clock::now();
+
+/// Wait on a condition, forever for portMAX_DELAY.
+template<typename Predicate>
+static bool wait_for(std::condition_variable& cv, std::unique_lock<std::mutex>& lock,
+  const TickType_t timeout, Predicate predicate) {
+  if (timeout == portMAX_DELAY) {
+    cv.wait(lock, predicate);
+    return true;
+  }
+  return cv.wait_for(lock, std::chrono::milliseconds(timeout), predicate);
+}
+
+BaseType_t xTaskCreate(const TaskFunction_t function, const char*, uint32_t,
+  void* parameters, UBaseType_t, TaskHandle_t* created) {
+  auto* task = new HostTask;
+  if (created) {
+    *created = task;
+  }
+  std::thread([task, function, parameters] {
+    current_task = task;
+    function(parameters);
+  }).detach();
+  return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (current_task == nullptr) {
+    current_task = new HostTask;
+  }
+  return current_task;
+}
+
+TickType_t xTaskGetTickCount() {
+  const auto elapsed = std::chrono::steady_clock::now() - start_time;
+  return static_cast<TickType_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+
+void vTaskDelay(const TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+BaseType_t xTaskNotifyGive(const TaskHandle_t task) {
+  {
+    std::lock_guard lock(task->mutex);
+    task->notifications++;
+  }
+  task->changed.notify_all();
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(const BaseType_t clearOnExit, const TickType_t timeout) {
+  HostTask* task = xTaskGetCurrentTaskHandle();
+  std::unique_lock lock(task->mutex);
+  if (!wait_for(task->changed, lock, timeout, [task] { return task->notifications > 0; })) {
+    return 0;
+  }
+  const uint32_t value = task->notifications;
+  task->notifications = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+QueueHandle_t xQueueCreate(const UBaseType_t length, const UBaseType_t itemSize) {
+  auto* queue = new HostQueue;
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+BaseType_t xQueueSend(const QueueHandle_t queue, const void* item, const TickType_t timeout) {
+  std::unique_lock lock(queue->mutex);
+  if (!wait_for(queue->changed, lock, timeout, [queue] { return queue->items.size() < queue->length; })) {
+    return pdFALSE;
+  }
+  const auto* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  lock.unlock();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(const QueueHandle_t queue, void* item, const TickType_t timeout) {
+  std::unique_lock lock(queue->mutex);
+  if (!wait_for(queue->changed, lock, timeout, [queue] { return !queue->items.empty(); })) {
+    return pdFALSE;
+  }
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  lock.unlock();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t xQueueReset(const QueueHandle_t queue) {
+  {
+    std::lock_guard lock(queue->mutex);
+    queue->items.clear();
+  }
+  queue->changed.notify_all();
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t queue) {
+  std::lock_guard lock(queue->mutex);
+  return queue->items.size();
+}
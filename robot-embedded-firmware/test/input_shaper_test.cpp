@@ -0,0 +1,75 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// InputShaper: ZV settles after half a damped period, and reconfiguring
+// in the middle of a move does not make the output jump.
+
+#include "robot/input_shaper.hpp"
+
+#include "test.hpp"
+
+static constexpr float DT = 0.02f;
+
+TEST(zv_step_settles_after_half_period) {
+  InputShaper shaper(DT);
+  shaper.configure(InputShaper::ZV, 2.0f, 0.0f);
+  shaper.reset(0);
+  EXPECT_NEAR(shaper.delay(), 0.26f, 1e-6f); // 0.25 s rounded up to whole samples
+
+  InputShaper::Sample output = {};
+  for (int i = 0; i < 20; i++) {
+    output = shaper.update({ 10, 0, 0 });
+  }
+  EXPECT_NEAR(output.position, 10.0f, 1e-5f);
+  EXPECT(shaper.settled());
+}
+
+TEST(reconfigure_mid_motion_is_continuous) {
+  InputShaper shaper(DT);
+  shaper.configure(InputShaper::ZV, 2.0f, 0.2f);
+  shaper.reset(0);
+
+  float position = 0;
+  InputShaper::Sample output = {};
+  for (int i = 0; i < 30; i++) {
+    position += 1;
+    output = shaper.update({ position, 50, 0 });
+  }
+  const float before = output.position;
+
+  shaper.configure(InputShaper::ZV, 1.0f, 0.1f);
+  output = shaper.update({ position + 1, 50, 0 });
+  // starts from where the output was, never back toward the old history or past the input
+  EXPECT(output.position >= before);
+  EXPECT(output.position <= position + 1);
+
+  for (int i = 0; i < 64; i++) {
+    output = shaper.update({ position + 1, 0, 0 });
+  }
+  EXPECT_NEAR(output.position, position + 1, 1e-4f);
+}
+
+TEST(same_parameters_keep_history) {
+  InputShaper shaper(DT);
+  shaper.configure(InputShaper::ZV, 2.0f, 0.2f);
+  shaper.reset(0);
+  shaper.update({ 10, 0, 0 });
+  const InputShaper::Sample first = shaper.update({ 10, 0, 0 });
+  shaper.configure(InputShaper::ZV, 2.0f, 0.2f);
+  const InputShaper::Sample second = shaper.update({ 10, 0, 0 });
+  EXPECT_NEAR(second.position, first.position, 1e-6f);
+}
+
+TEST_MAIN()
@@ -0,0 +1,234 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// Matrix benchmark: the control-math kernels with Matrix, with naive loops
+// whose bounds are only known at run time, and with fixed-size Eigen.
+//
+//   matrix_bench [iterations]
+
+#include "foc/common/matrix.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef HAVE_EIGEN
+#include <Eigen/Dense>
+#endif
+
+static constexpr size_t N = 4; // balance estimator state
+static constexpr size_t S = 6; // solver size
+
+// Naive reference kernels: row-major float arrays, run-time dimensions
+
+static void naive_multiply(const float* a, const float* b, float* out, const size_t n, const size_t m, const size_t k) {
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < k; j++) {
+      float sum = 0;
+      for (size_t l = 0; l < m; l++) sum += a[i * m + l] * b[l * k + j];
+      out[i * k + j] = sum;
+    }
+}
+
+static void naive_transpose(const float* a, float* out, const size_t n, const size_t m) {
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < m; j++) out[j * n + i] = a[i * m + j];
+}
+
+static void naive_covariance(const float* F, const float* P, const float* Q, float* out, const size_t n) {
+  float FP[S * S], Ft[S * S];
+  naive_multiply(F, P, FP, n, n, n);
+  naive_transpose(F, Ft, n, n);
+  naive_multiply(FP, Ft, out, n, n, n);
+  for (size_t i = 0; i < n * n; i++) out[i] += Q[i];
+}
+
+static void naive_cholesky_solve(const float* A, const float* b, float* x, const size_t n) {
+  float L[S * S] = {};
+  for (size_t j = 0; j < n; j++) {
+    float d = A[j * n + j];
+    for (size_t k = 0; k < j; k++) d -= L[j * n + k] * L[j * n + k];
+    L[j * n + j] = sqrtf(d);
+    for (size_t i = j + 1; i < n; i++) {
+      float s = A[i * n + j];
+      for (size_t k = 0; k < j; k++) s -= L[i * n + k] * L[j * n + k];
+      L[i * n + j] = s / L[j * n + j];
+    }
+  }
+  for (size_t i = 0; i < n; i++) {
+    float s = b[i];
+    for (size_t j = 0; j < i; j++) s -= L[i * n + j] * x[j];
+    x[i] = s / L[i * n + i];
+  }
+  for (size_t i = n; i-- > 0;) {
+    float s = x[i];
+    for (size_t j = i + 1; j < n; j++) s -= L[j * n + i] * x[j];
+    x[i] = s / L[i * n + i];
+  }
+}
+
+static void naive_lu_solve(const float* A, const float* b, float* x, const size_t n) {
+  float a[S * S], y[S];
+  for (size_t i = 0; i < n * n; i++) a[i] = A[i];
+  for (size_t i = 0; i < n; i++) y[i] = b[i];
+  for (size_t k = 0; k < n; k++) {
+    size_t p = k;
+    for (size_t i = k + 1; i < n; i++)
+      if (fabsf(a[i * n + k]) > fabsf(a[p * n + k])) p = i;
+    for (size_t j = 0; j < n; j++) {
+      const float t = a[k * n + j];
+      a[k * n + j] = a[p * n + j];
+      a[p * n + j] = t;
+    }
+    const float t = y[k];
+    y[k] = y[p];
+    y[p] = t;
+    for (size_t i = k + 1; i < n; i++) {
+      const float f = a[i * n + k] / a[k * n + k];
+      for (size_t j = k; j < n; j++) a[i * n + j] -= f * a[k * n + j];
+      y[i] -= f * y[k];
+    }
+  }
+  for (size_t i = n; i-- > 0;) {
+    float s = y[i];
+    for (size_t j = i + 1; j < n; j++) s -= a[i * n + j] * x[j];
+    x[i] = s / a[i * n + i];
+  }
+}
+
+// Inputs are perturbed every iteration and results summed so the compiler
+// can neither hoist nor drop the kernel.
+
+template<typename Kernel>
+static double time_ns(const long iterations, Kernel kernel) {
+  const auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++) kernel(static_cast<float>(i & 0xff) * 1e-6f);
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static volatile float sink;
+
+template<size_t R, size_t C>
+static Matrix<R, C> pattern(const float scale, const float diagonal) {
+  Matrix<R, C> m{};
+  for (size_t i = 0; i < R; i++)
+    for (size_t j = 0; j < C; j++) m(i, j) = scale * static_cast<float>((i * 7 + j * 3) % 5) + (i == j ? diagonal : 0.0f);
+  return m;
+}
+
+int main(const int argc, char** argv) {
+  const long iterations = argc > 1 ? atol(argv[1]) : 2000000;
+  // run-time dimensions for the naive kernels
+  volatile size_t runtime_n = N;
+  volatile size_t runtime_s = S;
+  const size_t n = runtime_n;
+  const size_t s = runtime_s;
+
+  const auto A = pattern<N, N>(0.1f, 1.0f);
+  const auto B = pattern<N, N>(0.2f, 0.5f);
+  const auto F = pattern<N, N>(0.005f, 1.0f);
+  const auto P = pattern<N, N>(0.01f, 2.0f) * pattern<N, N>(0.01f, 2.0f).transpose();
+  const auto Q = pattern<N, N>(0.0f, 0.001f);
+  const auto M = pattern<S, S>(0.1f, 0.0f);
+  const auto SPD = M * M.transpose() + Matrix<S, S>::identity() * 2.0f;
+  const auto b = pattern<S, 1>(0.3f, 1.0f);
+
+  printf("%-28s %10s %10s %10s\n", "ns per call", "Matrix", "naive", "Eigen");
+
+  auto row = [](const char* name, const double matrix, const double naive, const double eigen) {
+    printf("%-28s %10.1f %10.1f", name, matrix, naive);
+    if (eigen >= 0) {
+      printf(" %10.1f", eigen);
+    }
+    else {
+      printf(" %10s", "-");
+    }
+    printf("\n");
+  };
+
+#ifdef HAVE_EIGEN
+  using Eigen4 = Eigen::Matrix<float, N, N, Eigen::RowMajor>;
+  using Eigen6 = Eigen::Matrix<float, S, S, Eigen::RowMajor>;
+  const Eigen4 eA = Eigen4::Map(&A.data[0][0]);
+  const Eigen4 eB = Eigen4::Map(&B.data[0][0]);
+  const Eigen4 eF = Eigen4::Map(&F.data[0][0]);
+  const Eigen4 eP = Eigen4::Map(&P.data[0][0]);
+  const Eigen4 eQ = Eigen4::Map(&Q.data[0][0]);
+  const Eigen6 eSPD = Eigen6::Map(&SPD.data[0][0]);
+  const Eigen::Matrix<float, S, 1> eb = Eigen::Matrix<float, S, 1>::Map(&b.data[0][0]);
+#define EIGEN_TIME(expression) time_ns(iterations, [&](const float e) { expression; })
+#else
+#define EIGEN_TIME(expression) -1.0
+#endif
+
+  row("4x4 multiply",
+    time_ns(iterations, [&](const float e) { sink = ((A + e * B) * B)(1, 2); }),
+    time_ns(iterations, [&](const float e) {
+      float a[N * N], out[N * N];
+      for (size_t i = 0; i < n * n; i++) a[i] = (&A.data[0][0])[i] + e * (&B.data[0][0])[i];
+      naive_multiply(a, &B.data[0][0], out, n, n, n);
+      sink = out[1 * n + 2];
+    }),
+    EIGEN_TIME(sink = ((eA + e * eB) * eB)(1, 2)));
+
+  row("4x4 transpose",
+    time_ns(iterations, [&](const float e) { sink = (A * e).transpose()(2, 1); }),
+    time_ns(iterations, [&](const float e) {
+      float a[N * N], out[N * N];
+      for (size_t i = 0; i < n * n; i++) a[i] = (&A.data[0][0])[i] * e;
+      naive_transpose(a, out, n, n);
+      sink = out[2 * n + 1];
+    }),
+    EIGEN_TIME(sink = (eA * e).transpose()(2, 1)));
+
+  row("4x4 F P F^T + Q",
+    time_ns(iterations, [&](const float e) {
+      const auto Pe = P + Q * e;
+      sink = (F * Pe * F.transpose() + Q)(0, 3);
+    }),
+    time_ns(iterations, [&](const float e) {
+      float p[N * N], out[N * N];
+      for (size_t i = 0; i < n * n; i++) p[i] = (&P.data[0][0])[i] + e * (&Q.data[0][0])[i];
+      naive_covariance(&F.data[0][0], p, &Q.data[0][0], out, n);
+      sink = out[0 * n + 3];
+    }),
+    EIGEN_TIME(const Eigen4 Pe = eP + eQ * e; sink = (eF * Pe * eF.transpose() + eQ)(0, 3)));
+
+  row("6x6 Cholesky solve",
+    time_ns(iterations, [&](const float e) {
+      sink = Cholesky<S>(SPD + Matrix<S, S>::identity() * e).solve(b)[5];
+    }),
+    time_ns(iterations, [&](const float e) {
+      float a[S * S], x[S];
+      for (size_t i = 0; i < s * s; i++) a[i] = (&SPD.data[0][0])[i] + (i % (s + 1) == 0 ? e : 0.0f);
+      naive_cholesky_solve(a, &b.data[0][0], x, s);
+      sink = x[5];
+    }),
+    EIGEN_TIME(sink = (eSPD + Eigen6::Identity() * e).llt().solve(eb)(5)));
+
+  row("6x6 LU solve",
+    time_ns(iterations, [&](const float e) {
+      sink = LU<S>(SPD + Matrix<S, S>::identity() * e).solve(b)[5];
+    }),
+    time_ns(iterations, [&](const float e) {
+      float a[S * S], x[S];
+      for (size_t i = 0; i < s * s; i++) a[i] = (&SPD.data[0][0])[i] + (i % (s + 1) == 0 ? e : 0.0f);
+      naive_lu_solve(a, &b.data[0][0], x, s);
+      sink = x[5];
+    }),
+    EIGEN_TIME(sink = (eSPD + Eigen6::Identity() * e).partialPivLu().solve(eb)(5)));
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// Matrix, Cholesky and LU against hand-computed results and, when Eigen is
+// available, against Eigen on random inputs.
+
+#include "foc/common/matrix.h"
+
+#include "test.hpp"
+
+#include <random>
+
+#ifdef HAVE_EIGEN
+#include <Eigen/Dense>
+#endif
+
+template<size_t R, size_t C>
+static Matrix<R, C> make(const float (&values)[R][C]) {
+  Matrix<R, C> m{};
+  for (size_t i = 0; i < R; i++)
+    for (size_t j = 0; j < C; j++) m(i, j) = values[i][j];
+  return m;
+}
+
+template<size_t R, size_t C>
+static void expect_matrix(const Matrix<R, C>& actual, const Matrix<R, C>& expected, const float tolerance) {
+  for (size_t i = 0; i < R; i++)
+    for (size_t j = 0; j < C; j++) EXPECT_NEAR(actual(i, j), expected(i, j), tolerance);
+}
+
+/// Symmetric positive definite: M Mᵀ + N I
+template<size_t N>
+static Matrix<N, N> random_spd(std::mt19937& rng) {
+  std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+  Matrix<N, N> M{};
+  for (size_t i = 0; i < N; i++)
+    for (size_t j = 0; j < N; j++) M(i, j) = value(rng);
+  return M * M.transpose() + Matrix<N, N>::identity() * static_cast<float>(N);
+}
+
+template<size_t R, size_t C>
+static Matrix<R, C> random_matrix(std::mt19937& rng) {
+  std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+  Matrix<R, C> m{};
+  for (size_t i = 0; i < R; i++)
+    for (size_t j = 0; j < C; j++) m(i, j) = value(rng);
+  return m;
+}
+
+TEST(multiply_matches_hand_result) {
+  const auto A = make<2, 3>({ { 1, 2, 3 }, { 4, 5, 6 } });
+  const auto B = make<3, 2>({ { 7, 8 }, { 9, 10 }, { 11, 12 } });
+  expect_matrix(A * B, make<2, 2>({ { 58, 64 }, { 139, 154 } }), 0.0f);
+}
+
+TEST(transpose_swaps_rows_and_columns) {
+  const auto A = make<2, 3>({ { 1, 2, 3 }, { 4, 5, 6 } });
+  expect_matrix(A.transpose(), make<3, 2>({ { 1, 4 }, { 2, 5 }, { 3, 6 } }), 0.0f);
+}
+
+TEST(elementwise_operators) {
+  const auto A = make<2, 2>({ { 1, 2 }, { 3, 4 } });
+  const auto B = make<2, 2>({ { 4, 3 }, { 2, 1 } });
+  expect_matrix(A + B, make<2, 2>({ { 5, 5 }, { 5, 5 } }), 0.0f);
+  expect_matrix(A - B, make<2, 2>({ { -3, -1 }, { 1, 3 } }), 0.0f);
+  expect_matrix(2.0f * A, make<2, 2>({ { 2, 4 }, { 6, 8 } }), 0.0f);
+  expect_matrix(A / 2.0f, make<2, 2>({ { 0.5f, 1 }, { 1.5f, 2 } }), 0.0f);
+  expect_matrix(-A, make<2, 2>({ { -1, -2 }, { -3, -4 } }), 0.0f);
+}
+
+TEST(symmetrize_averages_off_diagonal) {
+  auto A = make<2, 2>({ { 1, 2 }, { 4, 3 } });
+  A.symmetrize();
+  expect_matrix(A, make<2, 2>({ { 1, 3 }, { 3, 3 } }), 0.0f);
+}
+
+TEST(cholesky_matches_hand_result) {
+  // classic example: L = [2 0 0; 6 1 0; -8 5 3]
+  const auto A = make<3, 3>({ { 4, 12, -16 }, { 12, 37, -43 }, { -16, -43, 98 } });
+  const Cholesky<3> cholesky(A);
+  EXPECT(cholesky.ok());
+  expect_matrix(cholesky.L, make<3, 3>({ { 2, 0, 0 }, { 6, 1, 0 }, { -8, 5, 3 } }), 1e-5f);
+
+  const auto b = make<3, 1>({ { 1 }, { 2 }, { 3 } });
+  expect_matrix(A * cholesky.solve(b), b, 1e-3f);
+}
+
+TEST(cholesky_rejects_indefinite_matrix) {
+  const auto A = make<2, 2>({ { 1, 2 }, { 2, 1 } });
+  EXPECT(!Cholesky<2>(A).ok());
+}
+
+TEST(lu_matches_hand_result) {
+  // needs a row swap: the first pivot is zero
+  const auto A = make<3, 3>({ { 0, 2, 1 }, { 1, 1, 0 }, { 2, 0, 3 } });
+  const LU<3> lu(A);
+  EXPECT(lu.ok());
+
+  const auto b = make<3, 1>({ { 7 }, { 3 }, { 11 } });
+  // x = [1 2 3]
+  expect_matrix(lu.solve(b), make<3, 1>({ { 1 }, { 2 }, { 3 } }), 1e-5f);
+  expect_matrix(A * lu.inverse(), Matrix<3, 3>::identity(), 1e-5f);
+}
+
+TEST(lu_rejects_singular_matrix) {
+  const auto A = make<3, 3>({ { 1, 2, 3 }, { 2, 4, 6 }, { 1, 0, 1 } });
+  EXPECT(!LU<3>(A).ok());
+}
+
+TEST(random_systems_solve_to_small_residual) {
+  std::mt19937 rng(39);
+  for (int n = 0; n < 100; n++) {
+    const auto A = random_spd<6>(rng);
+    const auto B = random_matrix<6, 2>(rng);
+    expect_matrix(A * Cholesky<6>(A).solve(B), B, 1e-4f);
+    expect_matrix(A * LU<6>(A).solve(B), B, 1e-4f);
+  }
+}
+
+#ifdef HAVE_EIGEN
+template<size_t R, size_t C>
+static Eigen::MatrixXf to_eigen(const Matrix<R, C>& m) {
+  Eigen::MatrixXf e(R, C);
+  for (size_t i = 0; i < R; i++)
+    for (size_t j = 0; j < C; j++) e(i, j) = m(i, j);
+  return e;
+}
+
+template<size_t R, size_t C>
+static void expect_eigen(const Matrix<R, C>& actual, const Eigen::MatrixXf& expected, const float tolerance) {
+  EXPECT(expected.rows() == static_cast<Eigen::Index>(R) && expected.cols() == static_cast<Eigen::Index>(C));
+  for (size_t i = 0; i < R; i++)
+    for (size_t j = 0; j < C; j++) EXPECT_NEAR(actual(i, j), expected(i, j), tolerance);
+}
+
+TEST(matches_eigen_on_random_inputs) {
+  std::mt19937 rng(390);
+  for (int n = 0; n < 100; n++) {
+    const auto A = random_matrix<4, 6>(rng);
+    const auto B = random_matrix<6, 3>(rng);
+    expect_eigen(A * B, to_eigen(A) * to_eigen(B), 1e-5f);
+    expect_eigen(A.transpose(), to_eigen(A).transpose(), 0.0f);
+
+    const auto S = random_spd<6>(rng);
+    const auto b = random_matrix<6, 1>(rng);
+    const Cholesky<6> cholesky(S);
+    const Eigen::LLT<Eigen::MatrixXf> llt(to_eigen(S));
+    expect_eigen(cholesky.L, Eigen::MatrixXf(llt.matrixL()), 1e-5f);
+    expect_eigen(cholesky.solve(b), llt.solve(to_eigen(b)), 1e-4f);
+
+    const auto G = random_matrix<6, 6>(rng) + Matrix<6, 6>::identity() * 2.0f;
+    const LU<6> lu(G);
+    const Eigen::PartialPivLU<Eigen::MatrixXf> plu(to_eigen(G));
+    expect_eigen(lu.solve(b), plu.solve(to_eigen(b)), 1e-4f);
+    expect_eigen(lu.inverse(), plu.inverse(), 1e-3f);
+  }
+}
+#endif
+
+TEST_MAIN()
@@ -0,0 +1,298 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+// STSServoBus against simulated servos: framing, SYNC READ ordering, error
+// paths and the turnaround after writes nobody waits for.
+
+#include "STSServoBus.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace sts;
+using Clock = std::chrono::steady_clock;
+
+/// \brief Servos sharing one half-duplex line, answering like an STS servo.
+class SimulatedBus final : public STSTransport {
+public:
+  struct Servo {
+    bool present = false;
+    bool corrupt = false; ///< Answer with a wrong checksum
+    uint8_t registers[256] = {};
+  };
+
+  /// Time between the end of an instruction and the first byte of the answer.
+  std::chrono::microseconds responseDelay{ 50 };
+
+  Servo servos[256];
+  uint32_t writes = 0;
+
+  size_t write(const uint8_t* data, const size_t length) override {
+    std::lock_guard lock(mutex_);
+    writes++;
+    lastWrite_ = Clock::now();
+    if (length < PACKET_OVERHEAD || data[0] != HEADER || data[1] != HEADER
+      || data[length - 1] != checksum(&data[2], length - 3)) {
+      return length;
+    }
+    const uint8_t id = data[2];
+    const uint8_t instruction = data[4];
+    const uint8_t* params = &data[5];
+    const size_t count = length - PACKET_OVERHEAD;
+    Clock::time_point due = lastWrite_ + responseDelay;
+
+    switch (instruction) {
+      case instruction::PING_:
+        answer(id, nullptr, 0, due);
+        break;
+      case instruction::READ:
+        if (id != BROADCAST_ID && servos[id].present) {
+          answer(id, &servos[id].registers[params[0]], params[1], due);
+        }
+        break;
+      case instruction::WRITE:
+        if (id == BROADCAST_ID || servos[id].present) {
+          memcpy(&servos[id].registers[params[0]], &params[1], count - 1);
+          answer(id, nullptr, 0, due);
+        }
+        break;
+      case instruction::SYNCWRITE:
+        for (size_t i = 2; i + params[1] < count; i += params[1] + 1) {
+          memcpy(&servos[params[i]].registers[params[0]], &params[i + 1], params[1]);
+        }
+        break;
+      case instruction::SYNCREAD:
+        for (size_t i = 2; i < count; i++) {
+          if (servos[params[i]].present) {
+            answer(params[i], &servos[params[i]].registers[params[0]], params[1], due);
+            due += std::chrono::microseconds(100);
+          }
+        }
+        break;
+      default:
+        break;
+    }
+    return length;
+  }
+
+  size_t read(uint8_t* buffer, const size_t capacity, const TickType_t timeout) override {
+    const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(timeout);
+    for (;;) {
+      {
+        std::lock_guard lock(mutex_);
+        size_t count = 0;
+        while (count < capacity && !pending_.empty() && pending_.front().due <= Clock::now()) {
+          buffer[count++] = pending_.front().value;
+          pending_.pop_front();
+        }
+        if (count > 0) {
+          return count;
+        }
+      }
+      if (Clock::now() >= deadline) {
+        return 0;
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(20));
+    }
+  }
+
+  void flush(const uint32_t quietUs) override {
+    std::this_thread::sleep_until(lastWrite_ + std::chrono::microseconds(quietUs));
+    std::lock_guard lock(mutex_);
+    while (!pending_.empty() && pending_.front().due <= Clock::now()) {
+      pending_.pop_front();
+    }
+  }
+
+private:
+  struct Byte {
+    uint8_t value;
+    Clock::time_point due;
+  };
+
+  void answer(const uint8_t id, const uint8_t* data, const uint8_t length, const Clock::time_point due) {
+    if (id == BROADCAST_ID || !servos[id].present) {
+      return;
+    }
+    uint8_t packet[MAX_STATUS_PARAMS + PACKET_OVERHEAD];
+    const size_t size = encode(id, 0, data, length, packet);
+    if (servos[id].corrupt) {
+      packet[size - 1] ^= 0x5A;
+    }
+    for (size_t i = 0; i < size; i++) {
+      pending_.push_back({ packet[i], due });
+    }
+  }
+
+  std::mutex mutex_;
+  std::deque<Byte> pending_;
+  Clock::time_point lastWrite_ = Clock::now();
+};
+
+static SimulatedBus* simulated() {
+  static SimulatedBus bus;
+  return &bus;
+}
+
+static STSServoBus* bus() {
+  static STSServoBus engine;
+  if (!engine.started()) {
+    engine.begin(simulated());
+  }
+  return &engine;
+}
+
+static STSRequest request(const uint8_t servoId, const uint8_t instruction,
+  std::initializer_list<uint8_t> params, const uint8_t responses) {
+  STSRequest request = {};
+  request.servoId = servoId;
+  request.instruction = instruction;
+  request.paramLength = params.size();
+  std::copy(params.begin(), params.end(), request.params);
+  request.responses = responses;
+  return request;
+}
+
+TEST(submit_before_begin_is_rejected) {
+  STSServoBus idle;
+  EXPECT(!idle.started());
+  EXPECT(!idle.submit(request(1, instruction::PING_, {}, 0)));
+}
+
+TEST(read_register) {
+  SimulatedBus::Servo& servo = simulated()->servos[1];
+  servo.present = true;
+  servo.registers[0x38] = 0x34;
+  servo.registers[0x39] = 0x12;
+
+  STSRequest read = request(1, instruction::READ, { 0x38, 2 }, 1);
+  STSResponse response;
+  EXPECT_EQ(bus()->transfer(read, &response), OK);
+  EXPECT_EQ(response.count, 1);
+  EXPECT_EQ(response.packets[0].id, 1);
+  EXPECT_EQ(response.packets[0].length, 2);
+  EXPECT_EQ(response.packets[0].params[0], 0x34);
+  EXPECT_EQ(response.packets[0].params[1], 0x12);
+}
+
+TEST(sync_read_collects_answers_in_order) {
+  simulated()->servos[1].present = true;
+  simulated()->servos[2].present = true;
+  simulated()->servos[1].registers[0x38] = 11;
+  simulated()->servos[2].registers[0x38] = 22;
+
+  STSRequest read = request(BROADCAST_ID, instruction::SYNCREAD, { 0x38, 1, 2, 1 }, 2);
+  STSResponse response;
+  EXPECT_EQ(bus()->transfer(read, &response), OK);
+  EXPECT_EQ(response.count, 2);
+  EXPECT_EQ(response.packets[0].id, 2);
+  EXPECT_EQ(response.packets[0].params[0], 22);
+  EXPECT_EQ(response.packets[1].id, 1);
+  EXPECT_EQ(response.packets[1].params[0], 11);
+}
+
+TEST(sync_read_with_missing_servo_times_out) {
+  simulated()->servos[1].present = true;
+  simulated()->servos[9].present = false;
+
+  STSRequest read = request(BROADCAST_ID, instruction::SYNCREAD, { 0x38, 1, 1, 9 }, 2);
+  STSResponse response;
+  EXPECT_EQ(bus()->transfer(read, &response), TIMEOUT);
+  EXPECT_EQ(response.count, 1);
+}
+
+TEST(absent_servo_times_out) {
+  STSRequest ping = request(42, instruction::PING_, {}, 1);
+  EXPECT_EQ(bus()->transfer(ping, nullptr), TIMEOUT);
+}
+
+TEST(corrupted_answer_is_a_checksum_error) {
+  SimulatedBus::Servo& servo = simulated()->servos[3];
+  servo.present = true;
+  servo.corrupt = true;
+  STSRequest ping = request(3, instruction::PING_, {}, 1);
+  EXPECT_EQ(bus()->transfer(ping, nullptr), CHECKSUM);
+  servo.corrupt = false;
+  ping = request(3, instruction::PING_, {}, 1);
+  EXPECT_EQ(bus()->transfer(ping, nullptr), OK);
+}
+
+TEST(oversized_request_is_rejected) {
+  STSRequest read = request(BROADCAST_ID, instruction::SYNCREAD, { 0x38, 1, 1, 2, 3, 4, 5 }, STS_MAX_RESPONSES + 1);
+  EXPECT_EQ(bus()->transfer(read, nullptr), TOO_LARGE);
+}
+
+TEST(late_answer_to_unawaited_write_is_dropped) {
+  // The servo answers the write after 150us; the next request must not take that answer for its own.
+  simulated()->responseDelay = std::chrono::microseconds(150);
+  simulated()->servos[1].present = true;
+  simulated()->servos[2].present = true;
+  simulated()->servos[2].registers[0x2A] = 7;
+
+  for (int i = 0; i < 20; i++) {
+    EXPECT(bus()->submit(request(1, instruction::WRITE, { 0x2A, static_cast<uint8_t>(i) }, 0)));
+    STSRequest read = request(2, instruction::READ, { 0x2A, 1 }, 1);
+    STSResponse response;
+    EXPECT_EQ(bus()->transfer(read, &response), OK);
+    EXPECT_EQ(response.packets[0].id, 2);
+    EXPECT_EQ(simulated()->servos[1].registers[0x2A], i);
+  }
+  simulated()->responseDelay = std::chrono::microseconds(50);
+}
+
+TEST(sync_write_updates_every_servo) {
+  simulated()->servos[1].present = true;
+  simulated()->servos[2].present = true;
+
+  // <start register> <length> then <id> <position low> <position high> per servo
+  const uint32_t writes = simulated()->writes;
+  EXPECT(bus()->submit(request(BROADCAST_ID, instruction::SYNCWRITE, { 0x2A, 2, 1, 0x10, 0x01, 2, 0x20, 0x02 }, 0)));
+  STSRequest ping = request(1, instruction::PING_, {}, 1);
+  EXPECT_EQ(bus()->transfer(ping, nullptr), OK);
+  EXPECT_EQ(simulated()->writes - writes, 2u);
+  EXPECT_EQ(simulated()->servos[1].registers[0x2A], 0x10);
+  EXPECT_EQ(simulated()->servos[1].registers[0x2B], 0x01);
+  EXPECT_EQ(simulated()->servos[2].registers[0x2A], 0x20);
+  EXPECT_EQ(simulated()->servos[2].registers[0x2B], 0x02);
+}
+
+TEST(callback_reports_result) {
+  simulated()->servos[1].present = true;
+  struct Completion {
+    TaskHandle_t task;
+    int result;
+    uint8_t count;
+  } completion = { xTaskGetCurrentTaskHandle(), BUSY, 0 };
+
+  STSRequest ping = request(1, instruction::PING_, {}, 1);
+  ping.context = &completion;
+  ping.callback = [](const int result, const STSResponse* response, void* context) {
+    auto* completion = static_cast<Completion*>(context);
+    completion->result = result;
+    completion->count = response ? response->count : 0;
+    xTaskNotifyGive(completion->task);
+  };
+  EXPECT(bus()->submit(ping));
+  EXPECT_EQ(ulTaskNotifyTake(pdTRUE, 100), 1u);
+  EXPECT_EQ(completion.result, OK);
+  EXPECT_EQ(completion.count, 1);
+}
+
+TEST_MAIN()
@@ -0,0 +1,98 @@
+// Copyright 2025 - 2026 the original author or authors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see [https://www.gnu.org/licenses/]
+
+#pragma once
+
+// Tiny test harness: each TEST registers itself, main() runs them all and
+// fails the process if any check failed.
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace test {
+
+struct Case {
+  const char* name;
+  void (*function)();
+};
+
+inline std::vector<Case>& cases() {
+  static std::vector<Case> registered;
+  return registered;
+}
+
+inline int& failures() {
+  static int count = 0;
+  return count;
+}
+
+struct Registrar {
+  Registrar(const char* name, void (*function)()) {
+    cases().push_back({ name, function });
+  }
+};
+
+inline int run() {
+  for (const Case& c : cases()) {
+    const int before = failures();
+    c.function();
+    printf("%s %s\n", failures() == before ? "[ OK ]" : "[FAIL]", c.name);
+  }
+  printf("%zu tests, %d failed checks\n", cases().size(), failures());
+  return failures() == 0 ? 0 : 1;
+}
+
+}
+
+#define TEST(name)                                              \
+  static void name();                                           \
+  static test::Registrar name##_registrar(#name, name);         \
+  static void name()
+
+#define EXPECT(condition)                                                   \
+  do {                                                                      \
+    if (!(condition)) {                                                     \
+      printf("%s:%d: expected %s\n", __FILE__, __LINE__, #condition);       \
+      test::failures()++;                                                   \
+    }                                                                       \
+  } while (0)
+
+#define EXPECT_EQ(actual, expected)                                                     \
+  do {                                                                                  \
+    const auto actual_ = (actual);                                                      \
+    const auto expected_ = (expected);                                                  \
+    if (!(actual_ == expected_)) {                                                      \
+      printf("%s:%d: %s == %lld, expected %lld\n", __FILE__, __LINE__, #actual,         \
+        static_cast<long long>(actual_), static_cast<long long>(expected_));            \
+      test::failures()++;                                                               \
+    }                                                                                   \
+  } while (0)
+
+#define EXPECT_NEAR(actual, expected, tolerance)                                        \
+  do {                                                                                  \
+    const double actual_ = (actual);                                                    \
+    const double expected_ = (expected);                                                \
+    if (!(std::fabs(actual_ - expected_) <= (tolerance))) {                             \
+      printf("%s:%d: %s == %g, expected %g +- %g\n", __FILE__, __LINE__, #actual,       \
+        actual_, expected_, static_cast<double>(tolerance));                            \
+      test::failures()++;                                                               \
+    }                                                                                   \
+  } while (0)
+
+#define TEST_MAIN()       \
+  int main() {            \
+    return test::run();   \
+  }
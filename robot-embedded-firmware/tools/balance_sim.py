@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+# Copyright 2025 - 2026 the original author or authors.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see [https://www.gnu.org/licenses/]
+
+"""
+平衡控制的主机仿真：对比原先的小转矩积分 + 重心自适应与扰动观测器
+
+模型（侧视，x 向前）：两轮倒立摆，车身为绕轮轴转动的质点 + 自身转动惯量，
+轮子滚动无滑移，地面摩擦为库仑摩擦 + 静摩擦（静止时需超过静摩擦力才会起步）。
+控制器沿用 balance_loop 的各项增益和限幅，5ms 周期；载荷在 2 秒时使质心前移。
+质心本身相对轮轴后移，名义平衡角度为 pitch_zeropoint（2°），控制器和固件一样先扣除它；
+"observer (absolute)" 一行是把绝对俯仰角送进观测器的旧接法，零点被扣了两次。
+
+扰动观测器的参数与固件（src/robot/disturbance_observer.cpp）一致，
+其中力矩系数故意与仿真对象不同，用来说明稳态结果不依赖模型精度。
+
+  python3 tools/balance_sim.py
+"""
+
+import math
+import random
+
+G = 9.81
+DT_PLANT = 0.0005
+DT_CONTROL = 0.005  # BALANCE_LOOP_INTERVAL
+
+# 仿真对象
+WHEEL_RADIUS = 0.034
+BODY_MASS = 0.58     # kg，tools/leg_kinematics.py 中车身和连杆之和
+WHEEL_MASS = 0.15    # kg，两轮等效质量（含转动惯量）
+BODY_INERTIA = 0.0015  # kg·m²，车身绕自身质心
+COM_HEIGHT = 0.10    # m
+TORQUE_PER_VOLT = 0.03  # N·m/V，LQR_u 每伏对应的两轮总力矩
+COULOMB_FRICTION = 0.25  # N
+STATIC_FRICTION = 0.35   # N
+
+PAYLOAD_TIME = 2.0
+PAYLOAD_OFFSET = 0.008  # m，载荷使质心前移
+
+PITCH_ZEROPOINT = 2.0  # °，lqr_controller 的 pitch_zeropoint：名义平衡角度
+NOMINAL_OFFSET = -COM_HEIGHT * math.tan(math.radians(PITCH_ZEROPOINT))  # m，使车身在该角度下平衡
+
+# 扰动观测器（与固件一致）
+DOB_TORQUE_PER_VOLT = 0.02
+DOB_FILTER_TF = 0.5
+DOB_ACCELERATION_TF = 0.05
+DOB_STANDSTILL_SPEED = 0.005
+
+
+def clamp(x, low, high):
+    return low if x < low else high if x > high else x
+
+
+class Plant:
+    def __init__(self):
+        self.p = 0.0      # 轮轴位置，m
+        self.v = 0.0
+        self.theta = math.radians(PITCH_ZEROPOINT + 1.0)  # 俯仰角，向前倒为正
+        self.omega = 0.0
+        self.offset = NOMINAL_OFFSET  # 质心水平偏移，m
+
+    def step(self, torque, dt):
+        length = math.hypot(COM_HEIGHT, self.offset)
+        psi = self.theta + math.atan2(self.offset, COM_HEIGHT)
+        a11 = BODY_MASS + WHEEL_MASS
+        a12 = BODY_MASS * length * math.cos(psi)
+        a22 = BODY_INERTIA + BODY_MASS * length * length
+        b2 = -torque + BODY_MASS * G * length * math.sin(psi)
+        centripetal = BODY_MASS * length * math.sin(psi) * self.omega ** 2
+
+        if self.v == 0.0:
+            # 轮子静止：先假设不动，所需摩擦力不超过静摩擦力就保持静止
+            theta_acc = b2 / a22
+            required = torque / WHEEL_RADIUS + centripetal - a12 * theta_acc
+            if abs(required) <= STATIC_FRICTION:
+                self.omega += theta_acc * dt
+                self.theta += self.omega * dt
+                return
+            friction = -math.copysign(COULOMB_FRICTION, required)
+        else:
+            friction = -math.copysign(COULOMB_FRICTION, self.v)
+
+        b1 = torque / WHEEL_RADIUS + centripetal + friction
+        det = a11 * a22 - a12 * a12
+        p_acc = (b1 * a22 - a12 * b2) / det
+        theta_acc = (a11 * b2 - a12 * b1) / det
+        v = self.v + p_acc * dt
+        # 库仑摩擦让速度过零时停住
+        self.v = 0.0 if self.v != 0.0 and v * self.v < 0 else v
+        self.p += self.v * dt
+        self.omega += theta_acc * dt
+        self.theta += self.omega * dt
+
+
+class PID:
+    """foc/common/pid.cpp 的 P + I 部分"""
+
+    def __init__(self, p, i, limit):
+        self.p, self.i, self.limit = p, i, limit
+        self.integral = 0.0
+        self.error_prev = 0.0
+
+    def __call__(self, error, dt):
+        integral = clamp(self.integral + self.i * dt * 0.5 * (error + self.error_prev), -self.limit, self.limit)
+        output = clamp(self.p * error + integral, -self.limit, self.limit)
+        self.integral, self.error_prev = integral, error
+        return output
+
+
+def feedback(pitch, rate, distance, speed, pitch_offset):
+    """balance_loop 中的角度、角速度、位移、速度四项，各自限幅 8V"""
+    return (clamp(1.0 * (pitch - pitch_offset), -8, 8) + clamp(0.06 * rate, -8, 8)
+            + clamp(0.5 * distance, -8, 8) + clamp(0.7 * speed, -8, 8))
+
+
+class Legacy:
+    """原先的 pid_lqr_u 小转矩积分 + pid_zeropoint 重心自适应"""
+
+    def __init__(self):
+        self.pid_lqr_u = PID(1, 15, 8)
+        self.zeropoint = 0.0
+        self.filtered = 0.0
+
+    def __call__(self, pitch, rate, distance, speed, effort):
+        distance_control = clamp(0.5 * distance, -8, 8)
+        u = feedback(pitch, rate, distance, speed, PITCH_ZEROPOINT + self.zeropoint)
+        if abs(u) < 5 and abs(distance_control) < 4:
+            u = self.pid_lqr_u(u, DT_CONTROL)
+            self.filtered += (distance_control - self.filtered) * DT_CONTROL / (0.1 + DT_CONTROL)
+            self.zeropoint -= clamp(0.002 * self.filtered, -4, 4)
+        else:
+            self.pid_lqr_u.error_prev = 0
+        return u
+
+
+class DisturbanceObserver:
+    """与 src/robot/disturbance_observer.cpp 相同的算法"""
+
+    def __init__(self):
+        self.initialized = False
+        self.rate = self.speed = 0.0
+        self.pitch_acceleration = self.acceleration = 0.0
+        self.torque = self.force = 0.0
+        self.pitch_offset = self.effort = 0.0
+
+    def update(self, dt, pitch, rate, speed, effort, com_height):
+        theta, omega, v = math.radians(pitch), math.radians(rate), speed * WHEEL_RADIUS
+        if not self.initialized:
+            self.rate, self.speed, self.initialized = omega, v, True
+            return
+        alpha = dt / (DOB_ACCELERATION_TF + dt)
+        self.pitch_acceleration += alpha * ((omega - self.rate) / dt - self.pitch_acceleration)
+        self.acceleration += alpha * ((v - self.speed) / dt - self.acceleration)
+        self.rate, self.speed = omega, v
+
+        mass_arm = BODY_MASS * com_height
+        torque = ((BODY_INERTIA + mass_arm * com_height) * self.pitch_acceleration + mass_arm * self.acceleration
+                  - mass_arm * G * math.sin(theta) + DOB_TORQUE_PER_VOLT * effort)
+        force = ((BODY_MASS + WHEEL_MASS) * self.acceleration + mass_arm * self.pitch_acceleration
+                 - DOB_TORQUE_PER_VOLT * effort / WHEEL_RADIUS)
+        q = dt / (DOB_FILTER_TF + dt)
+        self.torque += q * (torque - self.torque)
+        if abs(v) > DOB_STANDSTILL_SPEED:
+            self.force += q * (force - self.force)
+
+        self.effort = clamp(-WHEEL_RADIUS * self.force / DOB_TORQUE_PER_VOLT, -4, 4)
+        ratio = (-WHEEL_RADIUS * self.force - self.torque) / (mass_arm * G)
+        self.pitch_offset = clamp(math.degrees(math.asin(clamp(ratio, -1, 1))), -10, 10)
+
+
+class WithObserver:
+    """观测器输入相对名义平衡角度的俯仰角（固件的接法）"""
+
+    def __init__(self, absolute=False):
+        self.observer = DisturbanceObserver()
+        self.absolute = absolute
+
+    def __call__(self, pitch, rate, distance, speed, effort):
+        error = pitch - PITCH_ZEROPOINT
+        self.observer.update(DT_CONTROL, pitch if self.absolute else error, rate, speed, effort, COM_HEIGHT)
+        return feedback(error, rate, distance, speed, self.observer.pitch_offset) + self.observer.effort
+
+
+def simulate(controller, duration, noise, seed=1):
+    rng = random.Random(seed)
+    plant = Plant()
+    steps = round(DT_CONTROL / DT_PLANT)
+    u, t, trace = 0.0, 0.0, []
+    while t < duration:
+        if t >= PAYLOAD_TIME:
+            plant.offset = NOMINAL_OFFSET + PAYLOAD_OFFSET
+        pitch = math.degrees(plant.theta) + (rng.gauss(0, 0.05) if noise else 0)
+        rate = math.degrees(plant.omega) + (rng.gauss(0, 0.5) if noise else 0)
+        u = clamp(controller(pitch, rate, plant.p / WHEEL_RADIUS, plant.v / WHEEL_RADIUS, u), -24, 24)
+        for _ in range(steps):
+            plant.step(TORQUE_PER_VOLT * u, DT_PLANT)
+        t += DT_CONTROL
+        trace.append((t, plant.p, u))
+    return trace
+
+
+def settling_time(trace):
+    """载荷变化后位置漂移速度降到 1mm/s 以内并一直保持所需的时间"""
+    window = round(0.2 / DT_CONTROL)
+    last_moving = PAYLOAD_TIME
+    for i in range(len(trace) - window):
+        if trace[i][0] >= PAYLOAD_TIME and abs(trace[i + window][1] - trace[i][1]) > 0.001 * 0.2:
+            last_moving = trace[i + window][0]
+    return last_moving - PAYLOAD_TIME
+
+
+def main():
+    for name, factory in (("legacy", Legacy), ("observer", WithObserver),
+                          ("observer (absolute)", lambda: WithObserver(absolute=True))):
+        trace = simulate(factory(), 20.0, noise=False)
+        start = next(p for t, p, _ in trace if t >= PAYLOAD_TIME)
+        drift = (trace[-1][1] - start) * 1000
+        # 有测量噪声时，30 秒后静止阶段的位置摆动范围（极限环会让它明显变大）
+        wander = []
+        for seed in (1, 2, 3):
+            positions = [p for t, p, _ in simulate(factory(), 90.0, noise=True, seed=seed) if t > 30]
+            wander.append((max(positions) - min(positions)) * 1000)
+        print(f"{name:19s} settle {settling_time(trace):5.2f}s  drift {drift:6.1f}mm  "
+              f"standstill wander {' / '.join(f'{w:.1f}' for w in wander)}mm")
+
+
+if __name__ == "__main__":
+    main()
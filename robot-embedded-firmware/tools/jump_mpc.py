@@ -0,0 +1,502 @@
+#!/usr/bin/env python3
+# Copyright 2025 - 2026 the original author or authors.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see [https://www.gnu.org/licenses/]
+
+"""
+跳跃阶段显式模型预测控制（explicit MPC）查找表生成器
+
+跳跃时位移环、速度环不再有意义，原先只保留角度和角速度两项，饱和后既不最优也可能失稳。
+这里离线求解带电压约束的有限时域 MPC：
+
+  min  Σ xₖᵀQxₖ + R·uₖ² + x_Nᵀ P x_N     s.t.  x_{k+1} = A xₖ + B uₖ，|uₖ| ≤ U
+
+状态 x = [俯仰角(°)，俯仰角速度(°/s)，轮子相对车身的转速(rad/s)]，与 balance_loop 中的
+LQR_angle（扣除平衡零点）、LQR_gyro、LQR_speed 一致；输入为 LQR_u（V）。
+P 取无约束时 1 秒时域的 Riccati 解，腾空阶段角动量守恒、有一个不可控模态，
+不能用无限时域解。
+
+该问题的解是状态空间上的分段仿射函数：枚举约束的起作用集合，每个组合对应一个多面体区域
+和一条仿射控制律。区域按超平面组织成二叉搜索树（Tøndel 等，2003），叶子存放第一步的控制律；
+运行时沿树比较至多 MAX_DEPTH 次，再做一次仿射运算。
+
+两种模型：
+  - 着地（起跳蹬地、落地缓冲）：线性化两轮倒立摆，参数与扰动观测器一致；
+  - 腾空：车身和轮子之间只有电机内力矩，不受重力矩。
+电机力矩按反电动势衰减：τ = k (u - Ke·s)，u 是实际加到电机上的相电压。
+辨识过 KV 的电机在 move() 中会自动叠加反电动势补偿，跳跃查表期间固件把这部分扣掉，
+因此补偿开不开，表面对的都是同一个对象。
+
+参数改变后重新运行：
+  python3 tools/jump_mpc.py > src/robot/jump_mpc_table.h
+"""
+
+import itertools
+import math
+import random
+import sys
+
+G = 9.81
+DT = 0.005  # BALANCE_LOOP_INTERVAL
+
+# 名义模型，与 src/robot/disturbance_observer.cpp 一致
+WHEEL_RADIUS = 0.034
+BODY_MASS = 0.58
+WHEEL_MASS = 0.15
+BODY_INERTIA = 0.0015
+COM_HEIGHT = 0.085       # m，跳跃时腿收起，取较低的质心高度
+TORQUE_PER_VOLT = 0.02   # N·m/V
+BACK_EMF = 0.08          # V/(rad/s)，LQR_u 与轮子相对转速之比
+WHEEL_INERTIA = 3.5e-5   # kg·m²，两个轮子绕轮轴
+
+# LQR_u 上限，V：正弦调制以供电电压一半为中心，每个电机 Uq 最多为供电电压的一半，
+# K_SCALE 折半后 LQR_u 最多等于供电电压；按 2S 电池放空时的 6.0V 取值，整个放电过程都能输出
+EFFORT_LIMIT = 6.0
+HORIZON = 6              # 预测步数
+TERMINAL_STEPS = 200     # 终端代价的 Riccati 迭代步数（1 秒）
+MAX_DEPTH = 24
+
+# 查找表覆盖的状态范围，超出时按边界选择区域
+BOUNDS = (30.0, 400.0, 80.0)
+
+# 权重按 Bryson 法则：允许的最大偏差
+STANCE_WEIGHTS = ((3.0, 60.0, 40.0), 12.0)
+FLIGHT_WEIGHTS = ((2.0, 60.0, 120.0), 12.0)
+
+EPS = 1e-9
+
+
+# ---- 小型矩阵运算 ----
+
+def zeros(n, m):
+    return [[0.0] * m for _ in range(n)]
+
+
+def eye(n):
+    return [[1.0 if i == j else 0.0 for j in range(n)] for i in range(n)]
+
+
+def mul(a, b):
+    return [[sum(a[i][k] * b[k][j] for k in range(len(b))) for j in range(len(b[0]))] for i in range(len(a))]
+
+
+def add(a, b, scale=1.0):
+    return [[a[i][j] + scale * b[i][j] for j in range(len(a[0]))] for i in range(len(a))]
+
+
+def transpose(a):
+    return [list(row) for row in zip(*a)]
+
+
+def inverse(a):
+    n = len(a)
+    m = [list(a[i]) + eye(n)[i] for i in range(n)]
+    for c in range(n):
+        p = max(range(c, n), key=lambda r: abs(m[r][c]))
+        if abs(m[p][c]) < 1e-14:
+            raise ValueError("singular matrix")
+        m[c], m[p] = m[p], m[c]
+        pivot = m[c][c]
+        m[c] = [v / pivot for v in m[c]]
+        for r in range(n):
+            if r != c and m[r][c] != 0.0:
+                f = m[r][c]
+                m[r] = [v - f * w for v, w in zip(m[r], m[c])]
+    return [row[n:] for row in m]
+
+
+def discretize(a, b, dt):
+    """零阶保持离散化，矩阵指数取泰勒级数"""
+    n = len(a)
+    ad, bd_sum = eye(n), eye(n)
+    term = eye(n)
+    for k in range(1, 20):
+        term = [[v * dt / k for v in row] for row in mul(term, a)]
+        ad = add(ad, term)
+        bd_sum = add(bd_sum, [[v / (k + 1) for v in row] for row in term])
+    return ad, [[v * dt for v in row] for row in mul(bd_sum, b)]
+
+
+# ---- 模型 ----
+
+def stance_model():
+    """x = [θ, ω, s]（rad, rad/s, rad/s），s = v/r - ω 为轮子相对车身的转速"""
+    a11 = BODY_MASS + WHEEL_MASS
+    a12 = BODY_MASS * COM_HEIGHT
+    a22 = BODY_INERTIA + BODY_MASS * COM_HEIGHT ** 2
+    inv = inverse([[a11, a12], [a12, a22]])
+    k = TORQUE_PER_VOLT
+    # 广义力 [τ/r, -τ + mgLθ]，τ = k(u - Ke·s)
+    force_theta = [[0.0, 0.0], [BODY_MASS * G * COM_HEIGHT, 0.0]]
+    force_s = [[-k * BACK_EMF / WHEEL_RADIUS], [k * BACK_EMF]]
+    force_u = [[k / WHEEL_RADIUS], [-k]]
+    acc_theta = mul(inv, force_theta)  # [v', ω'] 对 θ
+    acc_s = mul(inv, force_s)
+    acc_u = mul(inv, force_u)
+    # s' = v'/r - ω'
+    a = [[0.0, 1.0, 0.0],
+         [acc_theta[1][0], 0.0, acc_s[1][0]],
+         [acc_theta[0][0] / WHEEL_RADIUS - acc_theta[1][0], 0.0, acc_s[0][0] / WHEEL_RADIUS - acc_s[1][0]]]
+    b = [[0.0], [acc_u[1][0]], [acc_u[0][0] / WHEEL_RADIUS - acc_u[1][0]]]
+    return a, b
+
+
+def flight_model():
+    """腾空：车身绕整机质心转动，电机力矩只在车身和轮子之间交换角动量"""
+    reduced = BODY_MASS * WHEEL_MASS / (BODY_MASS + WHEEL_MASS)
+    body = BODY_INERTIA + reduced * COM_HEIGHT ** 2
+    k = TORQUE_PER_VOLT
+    coupling = 1 / body + 1 / WHEEL_INERTIA
+    a = [[0.0, 1.0, 0.0],
+         [0.0, 0.0, k * BACK_EMF / body],
+         [0.0, 0.0, -k * BACK_EMF * coupling]]
+    b = [[0.0], [-k / body], [k * coupling]]
+    return a, b
+
+
+# ---- 多参数 QP ----
+
+class Controller:
+    def __init__(self, name, model, weights):
+        self.name = name
+        # 归一化坐标：y = x_fw / BOUNDS，输入 w = u / EFFORT_LIMIT
+        to_si = [math.radians(BOUNDS[0]), math.radians(BOUNDS[1]), BOUNDS[2]]
+        a, b = discretize(*model(), DT)
+        self.a = [[a[i][j] * to_si[j] / to_si[i] for j in range(3)] for i in range(3)]
+        self.b = [[b[i][0] * EFFORT_LIMIT / to_si[i]] for i in range(3)]
+        (x_max, u_max) = weights
+        self.q = [[(BOUNDS[i] / x_max[i]) ** 2 if i == j else 0.0 for j in range(3)] for i in range(3)]
+        self.r = (EFFORT_LIMIT / u_max) ** 2
+        self.p = self.riccati()
+        self.condense()
+
+    def riccati(self):
+        p = self.q
+        for _ in range(TERMINAL_STEPS):
+            bt_p = mul(transpose(self.b), p)
+            gain = mul(inverse(add([[self.r]], mul(bt_p, self.b))), mul(bt_p, self.a))
+            p = add(self.q, mul(mul(transpose(self.a), p), add(self.a, mul(self.b, gain), -1.0)))
+        return p
+
+    def condense(self):
+        """x_k = Φ_k y + Σ Γ_kj w_j；代价 ½wᵀHw + yᵀFᵀw + const"""
+        n = HORIZON
+        phi, gamma = [], []
+        power = eye(3)
+        for k in range(1, n + 1):
+            power = mul(self.a, power)
+            phi.append(power)
+            row = []
+            for j in range(n):
+                if j < k:
+                    m = self.b
+                    for _ in range(k - 1 - j):
+                        m = mul(self.a, m)
+                    row.append([r[0] for r in m])
+                else:
+                    row.append([0.0, 0.0, 0.0])
+            gamma.append(row)
+        self.h = zeros(n, n)
+        self.f = zeros(n, 3)
+        for k in range(n):
+            weight = self.p if k == n - 1 else self.q
+            for i in range(n):
+                wg_i = [sum(weight[r][c] * gamma[k][i][c] for c in range(3)) for r in range(3)]
+                for j in range(n):
+                    self.h[i][j] += 2 * sum(wg_i[r] * gamma[k][j][r] for r in range(3))
+                for c in range(3):
+                    self.f[i][c] += 2 * sum(wg_i[r] * phi[k][r][c] for r in range(3))
+        for i in range(n):
+            self.h[i][i] += 2 * self.r
+
+    def solve(self, y):
+        """投影梯度法直接求解，用于校验查找表"""
+        n = HORIZON
+        step = 1.0 / max(sum(abs(v) for v in row) for row in self.h)
+        grad_const = [sum(self.f[i][c] * y[c] for c in range(3)) for i in range(n)]
+        w = [0.0] * n
+        for _ in range(20000):
+            grad = [sum(self.h[i][j] * w[j] for j in range(n)) + grad_const[i] for i in range(n)]
+            w_new = [max(-1.0, min(1.0, w[i] - step * grad[i])) for i in range(n)]
+            if max(abs(p - q) for p, q in zip(w, w_new)) < 1e-12:
+                break
+            w = w_new
+        return w[0]
+
+    def regions(self):
+        """枚举起作用集合，返回 [(约束 [(a, b)], 第一步控制律 (k, g))]"""
+        n = HORIZON
+        result = []
+        for signs in itertools.product((0, 1, -1), repeat=n):
+            free = [i for i in range(n) if signs[i] == 0]
+            active = [i for i in range(n) if signs[i] != 0]
+            # w_F = -H_FF⁻¹ (H_FA σ + F_F y)，写成 w = W y + c
+            law_w = [[0.0, 0.0, 0.0] for _ in range(n)]
+            law_c = [float(signs[i]) for i in range(n)]
+            if free:
+                h_ff_inv = inverse([[self.h[i][j] for j in free] for i in free])
+                rhs_y = [self.f[i] for i in free]
+                rhs_c = [sum(self.h[i][j] * signs[j] for j in active) for i in free]
+                for a_idx, i in enumerate(free):
+                    law_w[i] = [-sum(h_ff_inv[a_idx][b_idx] * rhs_y[b_idx][c] for b_idx in range(len(free)))
+                                for c in range(3)]
+                    law_c[i] = -sum(h_ff_inv[a_idx][b_idx] * rhs_c[b_idx] for b_idx in range(len(free)))
+            constraints = box_constraints()
+            for i in free:
+                constraints.append((law_w[i], 1.0 - law_c[i]))
+                constraints.append(([-v for v in law_w[i]], 1.0 + law_c[i]))
+            for i in active:
+                # λ_i = -σ_i (H w + F y)_i ≥ 0
+                grad_y = [sum(self.h[i][j] * law_w[j][c] for j in range(n)) + self.f[i][c] for c in range(3)]
+                grad_c = sum(self.h[i][j] * law_c[j] for j in range(n))
+                s = signs[i]
+                constraints.append(([s * v for v in grad_y], -s * grad_c))
+            polytope = Polytope(constraints)
+            if polytope.full_dimensional():
+                result.append((polytope, (law_w[0], law_c[0])))
+        return result
+
+
+def box_constraints():
+    return [([1.0 if j == i else 0.0 for j in range(3)], 1.0) for i in range(3)] + \
+           [([-1.0 if j == i else 0.0 for j in range(3)], 1.0) for i in range(3)]
+
+
+def solve3(rows, rhs):
+    try:
+        inv = inverse(rows)
+    except ValueError:
+        return None
+    return [sum(inv[i][j] * rhs[j] for j in range(3)) for i in range(3)]
+
+
+class Polytope:
+    """{y | a·y ≤ b}，三维，顶点枚举"""
+
+    def __init__(self, constraints):
+        self.constraints = []
+        for a, b in constraints:
+            norm = math.sqrt(sum(v * v for v in a))
+            if norm < 1e-12:
+                if b < -1e-9:
+                    self.constraints.append(([0.0, 0.0, 0.0], -1.0))  # 不可行
+                continue
+            self.constraints.append(([v / norm for v in a], b / norm))
+        self.vertices = []
+        for i, j, k in itertools.combinations(range(len(self.constraints)), 3):
+            rows = [self.constraints[t][0] for t in (i, j, k)]
+            v = solve3(rows, [self.constraints[t][1] for t in (i, j, k)])
+            if v is None or any(dot(a, v) > b + 1e-9 for a, b in self.constraints):
+                continue
+            if all(max(abs(p - q) for p, q in zip(v, u)) > 1e-9 for u in self.vertices):
+                self.vertices.append(v)
+
+    def full_dimensional(self):
+        if len(self.vertices) < 4:
+            return False
+        c = [sum(v[i] for v in self.vertices) / len(self.vertices) for i in range(3)]
+        return min(b - dot(a, c) for a, b in self.constraints) > 1e-6
+
+    def facets(self):
+        for a, b in self.constraints:
+            on = [v for v in self.vertices if abs(dot(a, v) - b) < 1e-7]
+            if len(on) >= 3 and affine_rank(on) >= 2:
+                yield a, b
+
+    def side(self, a, b):
+        values = [dot(a, v) - b for v in self.vertices]
+        if max(values) <= 1e-7:
+            return -1
+        if min(values) >= -1e-7:
+            return 1
+        return 0
+
+
+def dot(a, b):
+    return sum(p * q for p, q in zip(a, b))
+
+
+def affine_rank(points):
+    base = points[0]
+    diffs = [[p[i] - base[i] for i in range(3)] for p in points[1:]]
+    for p, q in itertools.combinations(diffs, 2):
+        cross = [p[1] * q[2] - p[2] * q[1], p[2] * q[0] - p[0] * q[2], p[0] * q[1] - p[1] * q[0]]
+        if dot(cross, cross) > 1e-14:
+            return 2
+    return 1 if any(dot(d, d) > 1e-14 for d in diffs) else 0
+
+
+# ---- 二叉搜索树 ----
+
+def law_key(law):
+    k, g = law
+    return tuple(round(v, 7) for v in k) + (round(g, 7),)
+
+
+def build_tree(regions):
+    laws, law_index = [], {}
+    region_law = []
+    for _, law in regions:
+        key = law_key(law)
+        if key not in law_index:
+            law_index[key] = len(laws)
+            laws.append(law)
+        region_law.append(law_index[key])
+
+    # 候选超平面：非边界的区域边界面，去重并统一方向
+    planes, seen = [], set()
+    for polytope, _ in regions:
+        for a, b in polytope.facets():
+            if max(abs(v) for v in a) > 1 - 1e-9 and abs(b - 1) < 1e-9:
+                continue  # 状态范围的边界
+            first = next(v for v in a if abs(v) > 1e-9)
+            if first < 0:
+                a, b = [-v for v in a], -b
+            key = tuple(round(v, 6) for v in a) + (round(b, 6),)
+            if key not in seen:
+                seen.add(key)
+                planes.append((a, b))
+    sides = [[polytope.side(a, b) for polytope, _ in regions] for a, b in planes]
+
+    nodes = []
+    depth = [0]
+
+    def build(members, level):
+        depth[0] = max(depth[0], level)
+        distinct = {region_law[r] for r in members}
+        if len(distinct) == 1:
+            return -1 - distinct.pop()
+        if level >= MAX_DEPTH:
+            raise RuntimeError("tree deeper than MAX_DEPTH")
+        best = None
+        for p, side in enumerate(sides):
+            below = [r for r in members if side[r] != 1]
+            above = [r for r in members if side[r] != -1]
+            if len(below) == len(members) or len(above) == len(members):
+                continue
+            score = (max(len({region_law[r] for r in below}), len({region_law[r] for r in above})),
+                     max(len(below), len(above)), len(below) + len(above))
+            if best is None or score < best[0]:
+                best = (score, p, below, above)
+        if best is None:
+            raise RuntimeError("regions cannot be separated")
+        _, p, below, above = best
+        index = len(nodes)
+        nodes.append(None)
+        nodes[index] = (planes[p], build(below, level + 1), build(above, level + 1))
+        return index
+
+    root = build(list(range(len(regions))), 0)
+    return root, nodes, laws, depth[0]
+
+
+def lookup(tree, y):
+    root, nodes, laws, _ = tree
+    node = root
+    while node >= 0:
+        (a, b), below, above = nodes[node]
+        node = below if dot(a, y) <= b else above
+    return laws[-1 - node]
+
+
+def evaluate(tree, y):
+    k, g = lookup(tree, y)
+    return dot(k, y) + g
+
+
+def verify(controller, tree, count=400):
+    rng = random.Random(1)
+    worst = 0.0
+    for _ in range(count):
+        y = [rng.uniform(-1, 1) for _ in range(3)]
+        worst = max(worst, abs(evaluate(tree, y) - controller.solve(y)) * EFFORT_LIMIT)
+    return worst
+
+
+# ---- 输出 ----
+
+def emit(name, controller, tree, region_count):
+    root, nodes, laws, depth = tree
+    # y = x / BOUNDS：超平面和控制律换算到固件单位
+    print("// %s：%d 个区域，%d 条控制律，树深 %d" % (controller.name, region_count, len(laws), depth))
+    print("static const ExplicitMpcNode %s_nodes[] = {" % name)
+    for i, ((a, b), below, above) in enumerate(nodes):
+        print("  { { %.6ef, %.6ef, %.6ef }, %.6ef, %d, %d }, // %d"
+              % (a[0] / BOUNDS[0], a[1] / BOUNDS[1], a[2] / BOUNDS[2], b, below, above, i))
+    if not nodes:
+        print("  { { 0, 0, 0 }, 0, -1, -1 },")
+    print("};")
+    print()
+    print("static const ExplicitMpcLaw %s_laws[] = {" % name)
+    for i, (k, g) in enumerate(laws):
+        k, g = [v + 0.0 for v in k], g + 0.0  # 不输出 -0
+        print("  { { %.6ef, %.6ef, %.6ef }, %.6ef }, // %d"
+              % (k[0] * EFFORT_LIMIT / BOUNDS[0], k[1] * EFFORT_LIMIT / BOUNDS[1], k[2] * EFFORT_LIMIT / BOUNDS[2],
+                 g * EFFORT_LIMIT, i))
+    print("};")
+    print()
+    print("static const ExplicitMpcTable %s = {" % name)
+    print("  %s_nodes, %s_laws, { %.1ff, %.1ff, %.1ff }, %.1ff, %d, %d" % (
+        name, name, BOUNDS[0], BOUNDS[1], BOUNDS[2], EFFORT_LIMIT, root, depth))
+    print("};")
+
+
+def main():
+    controllers = [
+        ("jump_mpc_stance", Controller("着地", stance_model, STANCE_WEIGHTS)),
+        ("jump_mpc_flight", Controller("腾空", flight_model, FLIGHT_WEIGHTS)),
+    ]
+    results = []
+    for name, controller in controllers:
+        regions = controller.regions()
+        tree = build_tree(regions)
+        error = verify(controller, tree)
+        k, _ = lookup(tree, [0.0, 0.0, 0.0])  # 原点附近约束不起作用，即 LQR 增益
+        print("%s: %d regions, %d laws, %d nodes, depth %d, max error %.2e V, gain near zero %s" % (
+            name, len(regions), len(tree[2]), len(tree[1]), tree[3], error,
+            ", ".join("%.3f" % (k[i] * EFFORT_LIMIT / BOUNDS[i]) for i in range(3))), file=sys.stderr)
+        if error > 1e-3:
+            raise RuntimeError("lookup table does not match the QP solution")
+        results.append((name, controller, tree, len(regions)))
+
+    print("// Copyright 2025 - 2026 the original author or authors.")
+    print("//")
+    print("// This program is free software: you can redistribute it and/or modify")
+    print("// it under the terms of the GNU General Public License as published by")
+    print("// the Free Software Foundation, either version 3 of the License, or")
+    print("// (at your option) any later version.")
+    print("//")
+    print("// This program is distributed in the hope that it will be useful,")
+    print("// but WITHOUT ANY WARRANTY; without even the implied warranty of")
+    print("// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the")
+    print("// GNU General Public License for more details.")
+    print("//")
+    print("// You should have received a copy of the GNU General Public License")
+    print("// along with this program. If not, see [https://www.gnu.org/licenses/]")
+    print()
+    print("// 由 tools/jump_mpc.py 生成，请勿手动修改")
+    print()
+    print("#pragma once")
+    print()
+    print('#include "explicit_mpc.hpp"')
+    print()
+    print("// 状态 { 俯仰角(°), 俯仰角速度(°/s), 轮子转速(rad/s) }，输出 LQR_u(V)，预测 %d 步" % HORIZON)
+    print("// 节点 { 法向量, 偏移, a·x <= b 时的子节点, 否则的子节点 }，子节点为负数时是控制律 -1 - index")
+    for name, controller, tree, count in results:
+        print()
+        emit(name, controller, tree, count)
+
+
+if __name__ == "__main__":
+    main()
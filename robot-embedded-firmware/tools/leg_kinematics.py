@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright 2025 - 2026 the original author or authors.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see [https://www.gnu.org/licenses/]
+
+"""
+腿部连杆运动学查找表生成器
+
+模型（侧视，原点为髋关节/舵机轴，x 向前，z 向上）：
+  - 舵机驱动大腿，大腿向前、与水平面夹角 theta 随舵机行程线性增加
+  - 小腿从膝关节连到轮轴，另一侧的被动连杆把轮轴约束在 x = AXLE_X 的竖直线上
+  - 车身质心相对髋关节固定，连杆质量按各自中点计算
+
+输出以舵机行程（相对最低位置的计数）为索引，每项包含：
+  - 轮轴到髋关节的高度
+  - 整机质心相对轮轴的水平偏移和高度
+  - 质心位于轮轴正上方时的俯仰角（平衡零点前馈）
+
+几何参数改变后重新运行（参数实测前 MEASURED 保持 False，固件不使用前馈和增益插值）：
+  python3 tools/leg_kinematics.py > src/robot/leg_kinematics_table.h
+"""
+
+import math
+
+# 舵机：4096 计数/圈；行程 0 对应 SERVO_*_MIN（最低）
+COUNTS_PER_REV = 4096
+TRAVEL_MAX = 560      # max(|SERVO_LEFT_MAX - SERVO_LEFT_MIN|, |SERVO_RIGHT_MAX - SERVO_RIGHT_MIN|)
+TRAVEL_STEP = 16      # 表格步长，计数；必须是2的幂以便运行时用移位
+THETA_MIN_DEG = 10.0  # 最低位置时大腿低于水平面的角度
+
+# 连杆尺寸，单位：mm
+L_THIGH = 60.0
+L_SHIN = 75.0
+AXLE_X = 0.0
+
+# 质量，单位：g；位置相对髋关节，单位：mm
+M_BODY = 520.0
+BODY_COM = (3.0, 25.0)
+M_THIGH = 18.0
+M_SHIN = 14.0
+
+# 上面的尺寸和质量是估计值，实测后改为 True 再重新生成；为 False 时固件不使用查表得到的
+# 平衡零点前馈和速度环增益插值，沿用标定的 pitch_zeropoint 和按腿高分段的增益
+MEASURED = False
+
+
+def solve(travel):
+    theta = math.radians(THETA_MIN_DEG + travel * 360.0 / COUNTS_PER_REV)
+    knee = (L_THIGH * math.cos(theta), -L_THIGH * math.sin(theta))
+    axle = (AXLE_X, knee[1] - math.sqrt(L_SHIN ** 2 - (knee[0] - AXLE_X) ** 2))
+
+    # 左右两腿对称，质心只需要算一侧
+    parts = [
+        (M_BODY / 2, BODY_COM),
+        (M_THIGH, (knee[0] / 2, knee[1] / 2)),
+        (M_SHIN, ((knee[0] + axle[0]) / 2, (knee[1] + axle[1]) / 2)),
+    ]
+    mass = sum(m for m, _ in parts)
+    com_x = sum(m * p[0] for m, p in parts) / mass
+    com_z = sum(m * p[1] for m, p in parts) / mass
+
+    height = -axle[1]
+    com_offset = com_x - axle[0]
+    com_height = com_z - axle[1]
+    # 质心在轮轴前方时需要后仰才能回到轮轴正上方，向前为正
+    pitch = -math.degrees(math.atan2(com_offset, com_height))
+    return height, com_offset, com_height, pitch
+
+
+def main():
+    count = TRAVEL_MAX // TRAVEL_STEP + 2  # 末尾多一项，插值时无需判断边界
+    rows = [solve(i * TRAVEL_STEP) for i in range(count)]
+
+    print("// Copyright 2025 - 2026 the original author or authors.")
+    print("//")
+    print("// This program is free software: you can redistribute it and/or modify")
+    print("// it under the terms of the GNU General Public License as published by")
+    print("// the Free Software Foundation, either version 3 of the License, or")
+    print("// (at your option) any later version.")
+    print("//")
+    print("// This program is distributed in the hope that it will be useful,")
+    print("// but WITHOUT ANY WARRANTY; without even the implied warranty of")
+    print("// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the")
+    print("// GNU General Public License for more details.")
+    print("//")
+    print("// You should have received a copy of the GNU General Public License")
+    print("// along with this program. If not, see [https://www.gnu.org/licenses/]")
+    print()
+    print("// 由 tools/leg_kinematics.py 生成，请勿手动修改")
+    print()
+    print("#pragma once")
+    print()
+    print("#define LEG_KINEMATICS_STEP_SHIFT %d" % (TRAVEL_STEP.bit_length() - 1))
+    print("#define LEG_KINEMATICS_TRAVEL_MAX %d" % TRAVEL_MAX)
+    print("#define LEG_KINEMATICS_SIZE %d" % count)
+    print("#define LEG_KINEMATICS_MEASURED %d // 几何参数已实测" % int(MEASURED))
+    print()
+    print("// { 轮轴高度(mm), 质心水平偏移(mm), 质心高度(mm), 零点俯仰角(°) }，索引为行程 / %d" % TRAVEL_STEP)
+    print("static const float leg_kinematics_table[LEG_KINEMATICS_SIZE][4] = {")
+    for i, (h, x, z, p) in enumerate(rows):
+        print("  { %.3ff, %.3ff, %.3ff, %.4ff }, // %d" % (h, x, z, p, i * TRAVEL_STEP))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()